@@ -41,6 +41,8 @@ Runner::Runner(Input si)
     core_params_ = std::move(loaded.problem.core_params);
     CELER_ASSERT(core_params_);
     events_ = std::move(loaded.events);
+    event_reader_ = std::move(loaded.event_reader);
+    num_events_ = event_reader_ ? event_reader_->num_events() : events_.size();
     use_device_ = static_cast<bool>(si.system.device);
 
     CELER_VALIDATE(si.problem.tracking.limits.step_iters > 0,
@@ -58,7 +60,20 @@ Runner::Runner(Input si)
 
     transporters_.resize(this->num_streams());
 
+    if (event_reader_)
+    {
+        // Events are claimed sequentially from the reader
+        stream_events_.resize(this->num_streams());
+    }
+    else
+    {
+        // Set up the order in which preloaded events are handed out
+        event_queue_ = std::make_unique<EventQueue>(make_span(events_),
+                                                    si.events.largest_first);
+    }
+
     CELER_ENSURE(core_params_);
+    CELER_ENSURE(event_reader_ || event_queue_->size() == events_.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -86,6 +101,14 @@ auto Runner::operator()(StreamId stream, EventId event) -> RunnerResult
     CELER_EXPECT(event < this->num_events());
 
     auto& transport = this->get_transporter(stream);
+    if (event_reader_)
+    {
+        // Release the streamed event's memory after transporting it
+        CELER_EXPECT(!stream_events_[stream.get()].empty());
+        auto primaries = std::move(stream_events_[stream.get()]);
+        stream_events_[stream.get()] = {};
+        return transport(make_span(primaries));
+    }
     return transport(make_span(events_[event.get()]));
 }
 
@@ -102,6 +125,40 @@ auto Runner::operator()() -> RunnerResult
     return transport(make_span(events_.front()));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Claim the next event for a stream, or a null ID if none remain.
+ *
+ * This is thread safe and may be called concurrently from all streams. When
+ * events are streamed, the claimed event is read from the prefetch buffer and
+ * held for the stream until it is transported.
+ *
+ * If reading a streamed event fails, the reader's exception is thrown to the
+ * calling stream, and the remaining streams then see an exhausted queue.
+ * Callers inside an OpenMP parallel region must capture the exception (see
+ * \c CELER_TRY_HANDLE) rather than let it escape the region.
+ */
+EventId Runner::next_event(StreamId stream)
+{
+    CELER_EXPECT(stream < this->num_streams());
+
+    if (event_reader_)
+    {
+        // Read and number the event atomically so IDs match the input order
+        std::lock_guard<std::mutex> lock{event_reader_mutex_};
+        auto primaries = (*event_reader_)();
+        if (primaries.empty())
+        {
+            return {};
+        }
+        stream_events_[stream.get()] = std::move(primaries);
+        return id_cast<EventId>(num_read_events_++);
+    }
+
+    CELER_ASSERT(event_queue_);
+    return (*event_queue_)();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Number of streams supported.
@@ -118,7 +175,7 @@ StreamId::size_type Runner::num_streams() const
  */
 size_type Runner::num_events() const
 {
-    return events_.size();
+    return num_events_;
 }
 
 //---------------------------------------------------------------------------//
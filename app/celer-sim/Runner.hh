@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -15,6 +16,8 @@
 #include "corecel/Types.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/io/EventIOInterface.hh"
+#include "celeritas/phys/EventQueue.hh"
 #include "celeritas/phys/Primary.hh"
 
 #include "Transporter.hh"
@@ -41,6 +44,18 @@ namespace app
  *
  * This class is meant to be created in a single-thread context, and executed
  * in a multi-thread context.
+ *
+ * Events are dynamically scheduled: each stream repeatedly calls \c
+ * next_event to claim the next unprocessed event from a shared \c
+ * EventQueue, so that streams finishing early pick up the remaining work
+ * rather than idling. If \c inp::Events::largest_first is set, the most
+ * energetic events are handed out first.
+ *
+ * If \c inp::Events::prefetch is nonzero, events are not loaded at
+ * construction but are read on a background thread into a bounded buffer.
+ * In this mode, \c next_event pulls the next event from the buffer and
+ * holds it for the claiming stream until it is transported, so at most
+ * \c prefetch plus one event per stream are in memory.
  */
 class Runner
 {
@@ -66,6 +81,9 @@ class Runner
     // Run all events simultaneously on a single stream
     RunnerResult operator()();
 
+    // Claim the next event for a stream, or a null ID if none remain
+    EventId next_event(StreamId);
+
     // Number of streams supported
     StreamId::size_type num_streams() const;
 
@@ -101,6 +119,16 @@ class Runner
     VecEvent events_;
     std::vector<UPTransporterBase> transporters_;
 
+    // Shared queue of preloaded events
+    std::unique_ptr<EventQueue> event_queue_;
+    size_type num_events_{};
+
+    // Streamed events: reader, number read, and event claimed by each stream
+    std::unique_ptr<EventReaderInterface> event_reader_;
+    std::mutex event_reader_mutex_;
+    size_type num_read_events_{0};
+    VecEvent stream_events_;
+
     //// HELPER FUNCTIONS ////
 
     TransporterBase& get_transporter(StreamId);
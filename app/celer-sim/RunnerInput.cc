@@ -44,6 +44,7 @@ inp::System load_system(RunnerInput const& ri)
     inp::System s;
 
     s.environment = {ri.environ.begin(), ri.environ.end()};
+    s.share_params = ri.share_params;
 
     if (ri.use_device)
     {
@@ -75,6 +75,7 @@ struct RunnerInput
     size_type cuda_heap_size{unspecified};
     size_type cuda_stack_size{unspecified};
     Environment environ;  //!< Supplement existing env variables
+    bool share_params{false};  //!< Share host params across node processes
 
     // Problem definition
     std::string geometry_file;  //!< Path to GDML file
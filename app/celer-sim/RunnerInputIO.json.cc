@@ -52,6 +52,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(cuda_heap_size);
     LDIO_LOAD_OPTION(cuda_stack_size);
     LDIO_LOAD_OPTION(environ);
+    LDIO_LOAD_OPTION(share_params);
 
     LDIO_LOAD_DEPRECATED(hepmc3_filename, event_file);
     LDIO_LOAD_DEPRECATED(event_filename, event_file);
@@ -168,6 +169,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_OPTION(cuda_heap_size);
     LDIO_SAVE_OPTION(cuda_stack_size);
     LDIO_SAVE(environ);
+    LDIO_SAVE_OPTION(share_params);
 
     LDIO_SAVE(geometry_file);
     LDIO_SAVE(physics_file);
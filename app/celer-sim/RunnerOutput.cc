@@ -99,6 +99,7 @@ void RunnerOutput::output(JsonPimpl* j) const
         {"total", result_.total_time},
         {"setup", result_.setup_time},
         {"warmup", result_.warmup_time},
+        {"idle", result_.idle_times},
     });
 
     auto obj = json::object(
@@ -32,6 +32,7 @@ struct SimulationResult
     double warmup_time{};  //!< One-time warmup cost
     MapStrDouble action_times{};  //!< Accumulated mean action wall times
     VecVecDouble step_times{};  //!< Per-stream step times
+    std::vector<double> idle_times{};  //!< Per-stream time idle at end of run
     std::vector<TransporterResult> events;  //!< Results tallied for each event
     size_type num_streams{};  //!< Number of CPU/OpenMP threads
 };
@@ -212,7 +212,12 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries)
             << "Tracked " << counters.generators[0].num_generated
             << " photons for " << counters.steps << " steps, using "
             << counters.step_iters << " step iterations over "
-            << counters.flushes << " flushes";
+            << counters.flushes << " flushes ("
+            << static_cast<double>(counters.steps)
+                   / static_cast<double>(
+                       std::max<std::size_t>(counters.slot_iters, 1))
+            << " average occupancy, " << counters.tail_step_iters
+            << " tail step iterations)";
 
         auto const& buffer_counts = optical_->buffer_counts(aux);
         if (!buffer_counts.empty())
@@ -21,6 +21,7 @@
 #endif
 
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/io/BuildOutput.hh"
 #include "corecel/io/ExceptionOutput.hh"
 #include "corecel/io/FileOrConsole.hh"
@@ -132,11 +133,10 @@ void run(std::shared_ptr<OutputRegistry>& output,
         CELER_LOG(status) << "Transporting " << run_stream.num_events()
                           << " events on " << num_streams << " threads";
         MultiExceptionHandler capture_exception;
-        size_type const num_events = run_stream.num_events();
+        std::vector<double> finish_time(num_streams);
 #if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
-#    pragma omp parallel for
+#    pragma omp parallel num_threads(num_streams)
 #endif
-        for (size_type event = 0; event < num_events; ++event)
         {
             activate_device_local();
 #if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
@@ -145,17 +145,39 @@ void run(std::shared_ptr<OutputRegistry>& output,
             constexpr StreamId stream{0};
 #endif
 
-            // Run a single event on a single thread
-            TransporterResult event_result;
-            CELER_TRY_HANDLE(
-                event_result = run_stream(stream, id_cast<EventId>(event)),
-                capture_exception);
-            tracing_session.flush();
-            if (si.problem.diagnostics.counters.event)
+            // Claim events from the shared queue until none remain
+            while (true)
             {
-                result.events[event] = std::move(event_result);
+                // Exceptions must not escape the parallel region
+                EventId event;
+                CELER_TRY_HANDLE(event = run_stream.next_event(stream),
+                                 capture_exception);
+                if (!event)
+                {
+                    break;
+                }
+
+                // Run a single event on a single thread
+                TransporterResult event_result;
+                CELER_TRY_HANDLE(event_result = run_stream(stream, event),
+                                 capture_exception);
+                tracing_session.flush();
+                if (si.problem.diagnostics.counters.event)
+                {
+                    result.events[event.get()] = std::move(event_result);
+                }
             }
+            finish_time[stream.get()] = get_transport_time();
         }
+
+        // Save the time each stream spent waiting for the others to finish
+        double const end_time = get_transport_time();
+        result.idle_times.resize(num_streams);
+        for (auto i : range(num_streams))
+        {
+            result.idle_times[i] = end_time - finish_time[i];
+        }
+
         log_and_rethrow(std::move(capture_exception));
     }
     profile_this.reset();
@@ -416,6 +416,8 @@ void LocalTransporter::flush_impl()
 
     if (hit_processor_)
     {
+        // Make sure all hits reach the detectors before the event ends
+        hit_processor_->wait();
         auto num_hits = hit_processor_->exchange_hits();
         if (num_hits > 0)
         {
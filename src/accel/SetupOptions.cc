@@ -135,10 +135,9 @@ void ProblemSetup::operator()(inp::Problem& p) const
 
     if (celeritas::Device::num_devices())
     {
-        inp::DeviceDebug dd;
-        dd.sync_stream = so.action_times;
-
-        p.control.device_debug = std::move(dd);
+        // Action times are measured with device events, so the stream does
+        // not need to be synchronized
+        p.control.device_debug = inp::DeviceDebug{};
     }
 
     p.control.seed = CLHEP::HepRandom::getTheSeed();
@@ -290,6 +289,7 @@ inp::GeantSd to_inp(SDSetupOptions const& sd)
     result.energy_deposition = sd.energy_deposition;
     result.step_length = sd.step_length;
     result.track = sd.track;
+    result.async = sd.async;
     result.points[StepPoint::pre] = to_inp(sd.pre);
     result.points[StepPoint::pre].touchable = sd.locate_touchable;
     result.points[StepPoint::post] = to_inp(sd.post);
@@ -103,6 +103,8 @@ struct SDSetupOptions
     bool locate_touchable_post{true};
     //! Create a track with the dynamic particle type and post-step data
     bool track{true};
+    //! Call detectors from a helper thread while transport continues
+    bool async{false};
     //! Options for saving and converting beginning-of-step data
     StepPoint pre;
     //! Options for saving and converting end-of-step data
@@ -257,7 +259,7 @@ struct SetupOptions
     size_type cuda_stack_size{};
     //! Dynamic heap size (may be needed for VecGeom) [B]
     size_type cuda_heap_size{};
-    //! Sync the GPU at every kernel for timing
+    //! Record device timers around every action
     bool action_times{false};
     //! Launch all kernels on the default stream for debugging (REMOVED)
     bool default_stream{false};
@@ -53,6 +53,7 @@ char const* to_cstring(TrackOrder value)
         "reindex_shuffle",
         "reindex_status",
         "reindex_particle_type",
+        "reindex_volume",
         "reindex_along_step_action",
         "reindex_step_limit_action",
         "reindex_both_action",
@@ -60,6 +61,19 @@ char const* to_cstring(TrackOrder value)
     return to_cstring_impl(value);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to a track state memory layout.
+ */
+char const* to_cstring(StateLayout value)
+{
+    static EnumStringMapper<StateLayout> const to_cstring_impl{
+        "soa",
+        "aosoa",
+    };
+    return to_cstring_impl(value);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get a string corresponding to the MSC step limit algorithm.
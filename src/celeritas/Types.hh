@@ -159,8 +159,9 @@ enum class StepPoint
  * 3. Tracks are \em reindexed one or more times per step so that the layout
  *    in memory is unchanged but an additional indirection maps threads onto
  *    different track slots based on particle attributes (\c reindex_status,
- *    \c reindex_particle_type ), actions (\c reindex_along_step_action,
- *    \c reindex_step_limit_action, \c reindex_both_action ).
+ *    \c reindex_particle_type ), geometry state (\c reindex_volume ), or
+ *    actions (\c reindex_along_step_action, \c reindex_step_limit_action,
+ *    \c reindex_both_action ).
  * 4. As a control to measure the cost of indirection, the track slots can be
  *    reindexed randomly at the beginning of execution (\c reindex_shuffle ).
  */
@@ -176,6 +177,7 @@ enum class TrackOrder
     reindex_shuffle = begin_reindex_,
     reindex_status,  //!< Partition by active/inactive status
     reindex_particle_type,  //!< Sort by particle type
+    reindex_volume,  //!< Sort by geometry volume
     begin_reindex_action_,
     //! Sort only by the along-step action id
     reindex_along_step_action = begin_reindex_action_,
@@ -186,6 +188,23 @@ enum class TrackOrder
     size_ = end_reindex_
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Memory layout of track state data with multiple entries per track slot.
+ *
+ * With \c aosoa , the entries of small tiles of adjacent track slots are
+ * interleaved (array of structs of arrays) so that a sweep over track slots
+ * that reads one entry per track touches contiguous memory. This currently
+ * affects only the per-level position, direction, and volume of ORANGE
+ * geometry states: other per-track fields are already contiguous arrays.
+ */
+enum class StateLayout
+{
+    soa,  //!< All entries of a track slot are contiguous
+    aosoa,  //!< Entries are tiled across adjacent track slots
+    size_
+};
+
 //---------------------------------------------------------------------------//
 //! Algorithm used to calculate the multiple scattering step limit
 enum class MscStepLimitAlgorithm
@@ -258,6 +277,9 @@ char const* to_cstring(TrackStatus);
 // Get a string corresponding to a track ordering policy
 char const* to_cstring(TrackOrder);
 
+// Get a string corresponding to a track state memory layout
+char const* to_cstring(StateLayout);
+
 // Get a string corresponding to the MSC step limit algorithm
 char const* to_cstring(MscStepLimitAlgorithm value);
 
@@ -8,6 +8,7 @@
 
 #include "corecel/Macros.hh"
 #include "celeritas/field/DormandPrinceIntegrator.hh"
+#include "celeritas/field/HelixMixedIntegrator.hh"
 #include "celeritas/field/MakeMagFieldPropagator.hh"
 #include "celeritas/global/CoreTrackView.hh"
 
@@ -56,10 +57,26 @@ inline CELER_FUNCTION Propagation FieldTrackPropagator<Field>::operator()(
     CoreTrackView& track) const
 {
     auto sim = track.sim();
-    auto propagator = make_mag_field_propagator<DormandPrinceIntegrator>(
-        Field{field}, field.options, track.particle(), track.geometry());
-
-    Propagation p = propagator(sim.step_length());
+    Propagation p;
+    if (field.options.helix_field_tol > 0)
+    {
+        // Use an analytic helix where the field is nearly uniform
+        auto particle = track.particle();
+        auto propagator = make_field_propagator(
+            HelixMixedIntegrator{MagFieldEquation{Field{field},
+                                                  particle.charge()},
+                                 field.options.helix_field_tol},
+            field.options,
+            particle,
+            track.geometry());
+        p = propagator(sim.step_length());
+    }
+    else
+    {
+        auto propagator = make_mag_field_propagator<DormandPrinceIntegrator>(
+            Field{field}, field.options, track.particle(), track.geometry());
+        p = propagator(sim.step_length());
+    }
 
     sim.update_looping(p.looping);
     if (p.looping)
@@ -71,6 +71,7 @@ GeantSd::GeantSd(ParticleParams const& par,
                  Input const& setup,
                  StreamId::size_type num_streams)
     : nonzero_energy_deposition_(setup.ignore_zero_deposition)
+    , async_(setup.async)
 {
     CELER_EXPECT(num_streams > 0);
 
@@ -123,7 +124,7 @@ auto GeantSd::make_local_processor(StreamId sid) -> SPProcessor
     CELER_EXPECT(!processors_[sid.get()]);
 
     auto result = std::make_shared<HitProcessor>(
-        geant_vols_, particles_, selection_, locate_touchable_);
+        geant_vols_, particles_, selection_, locate_touchable_, async_);
     processor_weakptrs_[sid.get()] = result;
     processors_[sid.get()] = result.get();
     return result;
@@ -108,6 +108,7 @@ class GeantSd final : public StepInterface
     using VecLV = std::vector<G4LogicalVolume const*>;
 
     bool nonzero_energy_deposition_{};
+    bool async_{};
     VecVolId celer_vols_;
 
     // Hit processor setup
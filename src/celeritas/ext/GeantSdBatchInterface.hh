@@ -0,0 +1,68 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/GeantSdBatchInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+struct DetectorStepOutput;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Optional bulk hit callback for Geant4 sensitive detectors.
+ *
+ * A \c G4VSensitiveDetector that additionally inherits from this interface
+ * receives all of its hits from a step iteration in a single call instead of
+ * one reconstructed \c G4Step per hit. The hits are passed as the
+ * structure-of-arrays \c DetectorStepOutput along with the indices of the
+ * entries that belong to this detector, in their original order. Only the
+ * step attributes selected by \c inp::GeantSd are available in the output.
+ *
+ * Example:
+ * \code
+ class CaloSD final : public G4VSensitiveDetector,
+                      public celeritas::GeantSdBatchInterface
+ {
+   public:
+     void process_hits(DetectorStepOutput const& out,
+                       SpanConstIndex indices) final
+     {
+         for (auto i : indices)
+         {
+             edep_ += out.energy_deposition[i].value();
+         }
+     }
+     ...
+ };
+ * \endcode
+ */
+class GeantSdBatchInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SpanConstIndex = Span<size_type const>;
+    //!@}
+
+  public:
+    virtual ~GeantSdBatchInterface() = default;
+
+    //! Process all hits for this detector from a single step iteration
+    virtual void
+    process_hits(DetectorStepOutput const& out, SpanConstIndex indices)
+        = 0;
+
+  protected:
+    GeantSdBatchInterface() = default;
+    CELER_DEFAULT_COPY_MOVE(GeantSdBatchInterface);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -25,7 +25,7 @@
 
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeAndRedirect.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "geocel/GeantGeoParams.hh"
 #include "geocel/GeantUtils.hh"
 #include "geocel/ScopedGeantExceptionHandler.hh"
@@ -70,7 +70,7 @@ GeantSetup::GeantSetup(
     std::string const& gdml_filename, Options options, SetString sd_names)
 {
     CELER_LOG(status) << "Initializing Geant4 run manager";
-    ScopedProfiling profile_this{"initialize-geant"};
+    ScopedSetupPhase record_phase{"initialize-geant"};
 
     {
         // Run manager writes output that cannot be redirected with
@@ -6,6 +6,7 @@
 //---------------------------------------------------------------------------//
 #include "HitProcessor.hh"
 
+#include <algorithm>
 #include <cstddef>
 #include <utility>
 #include <CLHEP/Units/SystemOfUnits.h>
@@ -29,10 +30,12 @@
 #include "corecel/sys/TraceCounter.hh"
 #include "geocel/GeantGeoParams.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/ext/GeantSdBatchInterface.hh"
 #include "celeritas/ext/GeantTrackReconstruction.hh"
 #include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepData.hh"
 
+#include "HitWorker.hh"
 #include "LevelTouchableUpdater.hh"
 #include "../GeantStepPointView.hh"
 #include "../GeantStepView.hh"
@@ -99,7 +102,8 @@ G4StepStatus get_step_status(DetectorStepOutput const& out,
 HitProcessor::HitProcessor(SPConstVecLV detector_volumes,
                            VecParticle const& particles,
                            StepSelection const& selection,
-                           StepPointBool const& locate_touchable)
+                           StepPointBool const& locate_touchable,
+                           bool async)
     : detector_volumes_(std::move(detector_volumes))
     , ss_{selection}
     , step_post_status_{ss_.points[StepPoint::pre].volume_instance_ids
@@ -167,7 +171,46 @@ HitProcessor::HitProcessor(SPConstVecLV detector_volumes,
                        << StreamableLV{lv});
     }
 
+    // Find detectors that can process a whole group of hits at once
+    batch_detectors_.resize(detectors_.size());
+    for (auto i : range(detectors_.size()))
+    {
+        batch_detectors_[i]
+            = dynamic_cast<GeantSdBatchInterface*>(detectors_[i]);
+    }
+
+    if (async)
+    {
+        CELER_VALIDATE(!update_touchable_ && !track_reconstruction_,
+                       << "asynchronous hit processing cannot locate "
+                          "touchables or reconstruct tracks, which use "
+                          "thread-local Geant4 data");
+        for (auto i : range(detectors_.size()))
+        {
+            // G4VSensitiveDetector::Hit uses thread-local Geant4 state
+            CELER_VALIDATE(batch_detectors_[i],
+                           << "asynchronous hit processing requires the "
+                              "sensitive detector for volume '"
+                           << StreamableLV{(*detector_volumes_)[i]}
+                           << "' to implement GeantSdBatchInterface");
+        }
+        worker_ = std::make_unique<HitWorker>(
+            [this](DetectorStepOutput const& out) { (*this)(out); });
+    }
+
     CELER_ENSURE(!detectors_.empty());
+    CELER_ENSURE(batch_detectors_.size() == detectors_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for asynchronous processing to complete.
+ *
+ * The worker is stopped before any other data is destroyed.
+ */
+HitProcessor::~HitProcessor()
+{
+    worker_.reset();
 }
 
 //---------------------------------------------------------------------------//
@@ -176,12 +219,7 @@ HitProcessor::HitProcessor(SPConstVecLV detector_volumes,
  */
 void HitProcessor::operator()(StepStateHostRef const& states)
 {
-    copy_steps(&steps_, states);
-    if (steps_)
-    {
-        num_hits_ += steps_.size();
-        (*this)(steps_);
-    }
+    this->process_states(states);
 }
 
 //---------------------------------------------------------------------------//
@@ -190,11 +228,22 @@ void HitProcessor::operator()(StepStateHostRef const& states)
  */
 void HitProcessor::operator()(StepStateDeviceRef const& states)
 {
-    copy_steps(&steps_, states);
-    if (steps_)
+    this->process_states(states);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for asynchronously processed hits to be sent to the detectors.
+ *
+ * This must be called at the end of each transport loop so that all hits are
+ * recorded before the Geant4 event ends. It is a null-op if processing is
+ * synchronous.
+ */
+void HitProcessor::wait()
+{
+    if (worker_)
     {
-        num_hits_ += steps_.size();
-        (*this)(steps_);
+        worker_->wait();
     }
 }
 
@@ -205,14 +254,43 @@ void HitProcessor::operator()(StepStateDeviceRef const& states)
  * In an application setting, this is always called with our local data \c
  * steps_ as an argument. For tests, we can call this function explicitly using
  * local test data.
+ *
+ * Hits are grouped by detector so that each sensitive detector is called for
+ * a contiguous run of hits; within a detector, hits are processed in their
+ * original order. Detectors that implement \c GeantSdBatchInterface receive
+ * the whole group at once and are responsible for their own hit
+ * construction.
  */
-void HitProcessor::operator()(DetectorStepOutput const& out) const
+void HitProcessor::operator()(DetectorStepOutput const& out)
 {
     ScopedProfiling profile_this{"process-hits"};
     trace_counter("process-hits", out.size());
-    for (auto i : range(out.size()))
+
+    // Touchables from a previous batch may have been modified externally
+    for (auto& path : touchable_path_)
     {
-        (*this)(out, i);
+        path.clear();
+    }
+
+    this->group_by_detector(out);
+    auto indices = make_span(hit_indices_);
+    for (auto det_idx : range(detectors_.size()))
+    {
+        auto start = hit_offsets_[det_idx];
+        auto stop = hit_offsets_[det_idx + 1];
+        if (start == stop)
+        {
+            continue;
+        }
+        if (auto* batch = batch_detectors_[det_idx])
+        {
+            batch->process_hits(out, indices.subspan(start, stop - start));
+            continue;
+        }
+        for (auto i : indices.subspan(start, stop - start))
+        {
+            (*this)(out, i);
+        }
     }
 }
 
@@ -220,7 +298,7 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
 /*!
  * Generate and call a single hit.
  */
-void HitProcessor::operator()(DetectorStepOutput const& out, size_type i) const
+void HitProcessor::operator()(DetectorStepOutput const& out, size_type i)
 {
     CELER_EXPECT(!out.detector_id.empty());
     CELER_EXPECT(i < out.size());
@@ -243,11 +321,10 @@ void HitProcessor::operator()(DetectorStepOutput const& out, size_type i) const
             continue;
         }
 
-        if (auto& touch_handle = touch_handle_[sp])
+        if (touch_handle_[sp])
         {
-            CELER_ASSERT(update_touchable_);
             // Update navigation state
-            bool success = (*update_touchable_)(out, i, sp, touch_handle());
+            bool success = this->update_touchable(out, i, sp);
 
             if (CELER_UNLIKELY(!success))
             {
@@ -318,6 +395,108 @@ void HitProcessor::operator()(DetectorStepOutput const& out, size_type i) const
     this->detector(out.detector_id[i])->Hit(step_.get());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy hits from the step state and process them.
+ *
+ * When asynchronous, the hits are copied into the worker's front buffer,
+ * which is then processed while the next step runs.
+ */
+template<MemSpace M>
+void HitProcessor::process_states(
+    StepStateData<Ownership::reference, M> const& states)
+{
+    DetectorStepOutput& out = worker_ ? worker_->front() : steps_;
+    copy_steps(&out, states);
+    if (!out)
+    {
+        return;
+    }
+
+    num_hits_ += out.size();
+    if (worker_)
+    {
+        worker_->submit();
+    }
+    else
+    {
+        (*this)(out);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort hit indices by detector ID using a stable counting sort.
+ */
+void HitProcessor::group_by_detector(DetectorStepOutput const& out)
+{
+    CELER_EXPECT(out.detector_id.size() == out.size());
+
+    // Count hits per detector
+    hit_offsets_.assign(detectors_.size() + 1, 0);
+    for (DetectorId did : out.detector_id)
+    {
+        CELER_ASSERT(did < detectors_.size());
+        ++hit_offsets_[did.unchecked_get() + 1];
+    }
+
+    // Convert counts to starting offsets
+    for (auto i : range(std::size_t{1}, hit_offsets_.size()))
+    {
+        hit_offsets_[i] += hit_offsets_[i - 1];
+    }
+
+    // Scatter hit indices into their detector's group
+    hit_indices_.resize(out.size());
+    std::vector<size_type> pos(hit_offsets_.begin(), hit_offsets_.end() - 1);
+    for (auto i : range(out.size()))
+    {
+        hit_indices_[pos[out.detector_id[i].unchecked_get()]++] = i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update the touchable at a step point if its volume path changed.
+ *
+ * The previously located path is cached so consecutive hits in the same
+ * volume instance reuse the existing touchable.
+ */
+bool HitProcessor::update_touchable(DetectorStepOutput const& out,
+                                    size_type i,
+                                    StepPoint sp)
+{
+    CELER_EXPECT(update_touchable_);
+    CELER_EXPECT(touch_handle_[sp]);
+
+    auto& cached = touchable_path_[sp];
+    bool const have_path = !out.points[sp].volume_instance_ids.empty();
+    if (have_path)
+    {
+        auto path = LevelTouchableUpdater::volume_instances(out, i, sp);
+        if (!cached.empty()
+            && std::equal(
+                path.begin(), path.end(), cached.begin(), cached.end()))
+        {
+            // Same volume instance as the previous hit
+            return true;
+        }
+    }
+
+    ++num_relocations_;
+    bool success = (*update_touchable_)(out, i, sp, touch_handle_[sp]());
+    if (success && have_path)
+    {
+        auto path = LevelTouchableUpdater::volume_instances(out, i, sp);
+        cached.assign(path.begin(), path.end());
+    }
+    else
+    {
+        cached.clear();
+    }
+    return success;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
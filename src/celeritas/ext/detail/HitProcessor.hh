@@ -15,6 +15,8 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/EnumArray.hh"
+#include "corecel/cont/Span.hh"
+#include "geocel/Types.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepData.hh"
@@ -33,9 +35,12 @@ namespace celeritas
 {
 struct StepSelection;
 struct DetectorStepOutput;
+class GeantSdBatchInterface;
 
 namespace detail
 {
+class HitWorker;
+
 //---------------------------------------------------------------------------//
 /*!
  * Transfer Celeritas sensitive detector hits to Geant4.
@@ -49,10 +54,24 @@ namespace detail
  * class \b must be destroyed on the same thread on which it was created.
  *
  * Call operator:
- * - Loop over detector steps
- * - Update step attributes based on hit selection for the detector (TODO:
- *   selection is global for now)
- * - Call the local detector (based on detector ID from map) with the step
+ * - Group detector steps by detector ID, preserving their relative order
+ * - Pass each group to detectors that implement \c GeantSdBatchInterface
+ * - For other detectors, loop over the steps in the group:
+ *   - Update step attributes based on hit selection for the detector (TODO:
+ *     selection is global for now)
+ *   - Call the local detector (based on detector ID from map) with the step
+ *
+ * Touchables are only relocated when the volume instance path changes from
+ * the previous hit processed in the same batch: grouping by detector makes
+ * consecutive hits in the same volume instance common.
+ *
+ * In asynchronous mode, hits copied from the step state are processed on a
+ * helper thread (see \c HitWorker) while transport continues. Because Geant4
+ * allocators and managers are thread-local, this mode is incompatible with
+ * touchables and track reconstruction, and every sensitive detector must
+ * implement \c GeantSdBatchInterface so that \c G4VSensitiveDetector::Hit is
+ * never called from the helper thread. Call \c wait before using the
+ * detector output.
  *
  * Compare to Geant4 updating step/track info:
  * - \c G4VParticleChange::UpdateStepInfo
@@ -80,10 +99,12 @@ class HitProcessor
     HitProcessor(SPConstVecLV detector_volumes,
                  VecParticle const& particles,
                  StepSelection const& selection,
-                 StepPointBool const& locate_touchable);
+                 StepPointBool const& locate_touchable,
+                 bool async);
 
-    ~HitProcessor() = default;
-    CELER_DEFAULT_MOVE_DELETE_COPY(HitProcessor);
+    // Wait for asynchronous processing to complete
+    ~HitProcessor();
+    CELER_DELETE_COPY_MOVE(HitProcessor);
 
     // Process CPU-generated hits
     void operator()(StepStateHostRef const&);
@@ -92,10 +113,10 @@ class HitProcessor
     void operator()(StepStateDeviceRef const&);
 
     // Generate and call hits from a detector output (for testing)
-    void operator()(DetectorStepOutput const& out) const;
+    void operator()(DetectorStepOutput const& out);
 
     // Generate and call hits from a single detector hit
-    void operator()(DetectorStepOutput const& out, size_type i) const;
+    void operator()(DetectorStepOutput const& out, size_type i);
 
     // Access detector volume corresponding to an ID
     inline G4LogicalVolume const* detector_volume(DetectorId) const;
@@ -103,9 +124,15 @@ class HitProcessor
     // Access thread-local SD corresponding to an ID
     inline G4VSensitiveDetector* detector(DetectorId) const;
 
+    // Wait for asynchronously processed hits to be sent to the detectors
+    void wait();
+
     // Get and reset the hits counted (generally once per event)
     inline size_type exchange_hits();
 
+    //! Number of times a touchable was relocated (for testing)
+    size_type num_relocations() const { return num_relocations_; }
+
     //! Access local Geant4 track metadata reconstruction
     std::shared_ptr<GeantTrackReconstruction> const& track_reconstruction() const
     {
@@ -118,6 +145,8 @@ class HitProcessor
     StepSelection ss_;
     //! Map detector IDs to sensitive detectors
     std::vector<G4VSensitiveDetector*> detectors_;
+    //! Bulk callback for detectors that support it (else null)
+    std::vector<GeantSdBatchInterface*> batch_detectors_;
     //! Temporary CPU hit information
     DetectorStepOutput steps_;
 
@@ -136,8 +165,28 @@ class HitProcessor
     //! Whether geometry-related step status can be updated
     bool step_post_status_{false};
 
+    //! Hit indices grouped by detector, and the start of each group
+    std::vector<size_type> hit_indices_;
+    std::vector<size_type> hit_offsets_;
+    //! Volume instance path of the current touchable in this batch
+    EnumArray<StepPoint, std::vector<VolumeInstanceId>> touchable_path_;
+
     //! Accumulated number of hits
     size_type num_hits_{0};
+    //! Accumulated number of touchable updates
+    size_type num_relocations_{0};
+
+    //! Helper thread for asynchronous processing (destroyed first)
+    std::unique_ptr<HitWorker> worker_;
+
+    //// HELPER FUNCTIONS ////
+
+    template<MemSpace M>
+    void process_states(StepStateData<Ownership::reference, M> const&);
+    void group_by_detector(DetectorStepOutput const& out);
+    bool update_touchable(DetectorStepOutput const& out,
+                          size_type i,
+                          StepPoint sp);
 };
 
 //---------------------------------------------------------------------------//
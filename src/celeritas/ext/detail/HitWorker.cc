@@ -0,0 +1,123 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/detail/HitWorker.cc
+//---------------------------------------------------------------------------//
+#include "HitWorker.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the function that processes each batch.
+ */
+HitWorker::HitWorker(Callback process) : process_{std::move(process)}
+{
+    CELER_EXPECT(process_);
+    thread_ = std::thread{[this] { this->process_all(); }};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish the current batch and stop the helper thread.
+ *
+ * Errors from the final batch are discarded since destructors can't throw.
+ */
+HitWorker::~HitWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process the front buffer asynchronously and swap buffers.
+ *
+ * This waits for the previously submitted batch, whose buffer becomes the
+ * new front buffer on return.
+ */
+void HitWorker::submit()
+{
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        this->wait_impl(lock);
+        pending_ = &buffers_[front_];
+    }
+    cv_.notify_all();
+    front_ ^= 1u;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for the submitted batch to be processed.
+ *
+ * This must be called before any data used by the callback (e.g., Geant4
+ * hit collections) is accessed by the transport thread.
+ */
+void HitWorker::wait()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    this->wait_impl(lock);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait until no batch is pending and rethrow any processing error.
+ */
+void HitWorker::wait_impl(std::unique_lock<std::mutex>& lock)
+{
+    cv_.wait(lock, [this] { return pending_ == nullptr; });
+    if (error_)
+    {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process submitted batches until stopped.
+ */
+void HitWorker::process_all()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true)
+    {
+        cv_.wait(lock, [this] { return pending_ != nullptr || stop_; });
+        if (!pending_)
+        {
+            return;
+        }
+
+        // Process without holding the lock
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+            process_(*pending_);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        error_ = std::move(error);
+        pending_ = nullptr;
+        cv_.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
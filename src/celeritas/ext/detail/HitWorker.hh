@@ -0,0 +1,83 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/detail/HitWorker.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Array.hh"
+#include "celeritas/user/DetectorSteps.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Process detector step output on a helper thread using two buffers.
+ *
+ * The transport thread copies the gathered steps into the buffer returned by
+ * \c front and calls \c submit, which hands the buffer to the helper thread
+ * and swaps to the other buffer. Only one batch is processed at a time: \c
+ * submit blocks until the previous batch has been processed, so the helper
+ * thread never lags by more than a single step iteration. Exceptions raised
+ * by the callback are rethrown from the next \c submit or \c wait call on the
+ * transport thread.
+ */
+class HitWorker
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Callback = std::function<void(DetectorStepOutput const&)>;
+    //!@}
+
+  public:
+    // Construct with the function that processes each batch
+    explicit HitWorker(Callback process);
+
+    //! Prevent copying and moving
+    CELER_DELETE_COPY_MOVE(HitWorker);
+
+    // Finish the current batch and stop the helper thread
+    ~HitWorker();
+
+    //! Buffer that may be filled by the transport thread
+    DetectorStepOutput& front() { return buffers_[front_]; }
+
+    // Process the front buffer asynchronously and swap buffers
+    void submit();
+
+    // Wait for the submitted batch to be processed
+    void wait();
+
+  private:
+    Callback process_;
+    Array<DetectorStepOutput, 2> buffers_;
+    unsigned int front_{0};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    DetectorStepOutput const* pending_{nullptr};
+    std::exception_ptr error_;
+    bool stop_{false};
+
+    std::thread thread_;
+
+    //// HELPER FUNCTIONS ////
+
+    void wait_impl(std::unique_lock<std::mutex>& lock);
+    void process_all();
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -14,6 +14,7 @@
 #include "corecel/grid/FindInterp.hh"
 #include "corecel/grid/NonuniformGrid.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "corecel/math/Quantity.hh"
 #include "corecel/math/Turn.hh"
 #include "celeritas/Types.hh"
@@ -31,6 +32,12 @@ namespace celeritas
  * within each grid cell. The value outside the grid is zero.
  *
  * Currently the grid requires a full \f$2\pi\f$ azimuthal grid.
+ *
+ * The field is constructed for each track propagation, during which the
+ * integrator evaluates it several times per substep, usually inside the same
+ * grid cell. The bounds and corner values of the most recently used cell are
+ * therefore kept in the field object, so that the grid search and the
+ * eight-corner fetch are only repeated when the track leaves the cell.
  */
 class CylMapField
 {
@@ -50,12 +57,38 @@ class CylMapField
     CELER_FUNCTION inline Real3 operator()(Real3 const& pos) const;
 
   private:
+    //// TYPES ////
+
+    using RealCyl = Array<real_type, 3>;
+    using FieldValue = EnumArray<CylAxis, real_type>;
+
+    //! Bounds and field values at the corners of a single grid cell
+    struct CachedCell
+    {
+        RealCyl lower;
+        RealCyl upper;
+        Array<FieldValue, 8> corners;
+    };
+
+    //// DATA ////
+
     // Shared constant field map
     ParamsRef const& params_;
 
     NonuniformGrid<real_type> const grid_r_;
     NonuniformGrid<real_type> const grid_phi_;
     NonuniformGrid<real_type> const grid_z_;
+
+    // Most recently used cell (empty at construction)
+    mutable CachedCell cell_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Whether the point is inside the cached cell
+    inline CELER_FUNCTION bool in_cell(RealCyl const& coords) const;
+
+    // Locate the cell containing the point and load its corners
+    inline CELER_FUNCTION void load_cell(RealCyl const& coords) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -70,6 +103,9 @@ CELER_FUNCTION CylMapField::CylMapField(ParamsRef const& params)
     , grid_phi_{params_.grids.axes[CylAxis::phi], params_.grids.storage}
     , grid_z_{params_.grids.axes[CylAxis::z], params_.grids.storage}
 {
+    // Inverted bounds never contain a point
+    cell_.lower.fill(numeric_limits<real_type>::infinity());
+    cell_.upper.fill(-numeric_limits<real_type>::infinity());
 }
 
 //---------------------------------------------------------------------------//
@@ -97,30 +133,34 @@ CELER_FUNCTION auto CylMapField::operator()(Real3 const& pos) const -> Real3
     if (!params_.valid(r, phi, pos[2]))
         return {0, 0, 0};
 
-    // Find interpolation points for given r, phi, z
-    auto [ir, wr1] = find_interp<NonuniformGrid<real_type>>(grid_r_, r);
-    auto [iphi, wphi1]
-        = find_interp<NonuniformGrid<real_type>>(grid_phi_, phi.value());
-    auto [iz, wz1] = find_interp<NonuniformGrid<real_type>>(grid_z_, pos[2]);
+    RealCyl const coords{r, phi.value(), static_cast<real_type>(pos[2])};
+    if (!this->in_cell(coords))
+    {
+        this->load_cell(coords);
+    }
 
-    auto get_field = [this](size_type ir, size_type iphi, size_type iz) {
-        return params_.fieldmap[params_.id(ir, iphi, iz)];
-    };
+    // Fractional position inside the cell
+    RealCyl w;
+    for (auto ax : range(3))
+    {
+        w[ax] = (coords[ax] - cell_.lower[ax])
+                / (cell_.upper[ax] - cell_.lower[ax]);
+    }
+    auto const& [wr1, wphi1, wz1] = w;
 
     EnumArray<CylAxis, real_type> interp_field;
 
     for (auto axis : range(CylAxis::size_))
     {
-        // clang-format off
-        real_type v000 = get_field(ir,     iphi    ,     iz)[axis];
-        real_type v001 = get_field(ir,     iphi    , iz + 1)[axis];
-        real_type v010 = get_field(ir,     iphi + 1,     iz)[axis];
-        real_type v011 = get_field(ir,     iphi + 1, iz + 1)[axis];
-        real_type v100 = get_field(ir + 1, iphi    ,     iz)[axis];
-        real_type v101 = get_field(ir + 1, iphi    , iz + 1)[axis];
-        real_type v110 = get_field(ir + 1, iphi + 1,     iz)[axis];
-        real_type v111 = get_field(ir + 1, iphi + 1, iz + 1)[axis];
-        // clang-format on
+        // Corners are ordered by (r, phi, z) offset bits
+        real_type v000 = cell_.corners[0b000][axis];
+        real_type v001 = cell_.corners[0b001][axis];
+        real_type v010 = cell_.corners[0b010][axis];
+        real_type v011 = cell_.corners[0b011][axis];
+        real_type v100 = cell_.corners[0b100][axis];
+        real_type v101 = cell_.corners[0b101][axis];
+        real_type v110 = cell_.corners[0b110][axis];
+        real_type v111 = cell_.corners[0b111][axis];
         // Trilinear interpolation formula for the current component
         interp_field[axis]
             = (1 - wr1)
@@ -144,5 +184,49 @@ CELER_FUNCTION auto CylMapField::operator()(Real3 const& pos) const -> Real3
     return {value[0], value[1], value[2]};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the point is inside the cached cell.
+ *
+ * The upper bound is exclusive to match the grid search.
+ */
+CELER_FUNCTION bool CylMapField::in_cell(RealCyl const& coords) const
+{
+    for (auto ax : range(3))
+    {
+        if (!(coords[ax] >= cell_.lower[ax] && coords[ax] < cell_.upper[ax]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Locate the cell containing the point and load its corners.
+ */
+CELER_FUNCTION void CylMapField::load_cell(RealCyl const& coords) const
+{
+    Array<NonuniformGrid<real_type> const*, 3> const grids{
+        &grid_r_, &grid_phi_, &grid_z_};
+    Array<size_type, 3> index;
+    for (auto ax : range(3))
+    {
+        auto const& grid = *grids[ax];
+        index[ax] = find_interp(grid, coords[ax]).index;
+        cell_.lower[ax] = grid[index[ax]];
+        cell_.upper[ax] = grid[index[ax] + 1];
+    }
+
+    for (auto corner : range(cell_.corners.size()))
+    {
+        cell_.corners[corner] = params_.fieldmap[params_.id(
+            index[0] + ((corner >> 2) & 1),
+            index[1] + ((corner >> 1) & 1),
+            index[2] + (corner & 1))];
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -64,6 +64,9 @@ struct FieldDriverOptions
     //! Maximum number of substeps in the field propagator
     short int max_substeps = 10;
 
+    //! Relative field change below which a substep uses a helix (0 to disable)
+    real_type helix_field_tol = 0;
+
     //! Initial step tolerance
     static constexpr real_type initial_step_tol = 1e-6;
 
@@ -87,7 +90,8 @@ struct FieldDriverOptions
 	       && (safety > 0 && safety < 1)
 	       && (max_stepping_increase > 1)
 	       && (max_stepping_decrease > 0 && max_stepping_decrease < 1)
-	       && (max_nsteps > 0) && (max_substeps > 0);
+	       && (max_nsteps > 0) && (max_substeps > 0)
+	       && (helix_field_tol >= 0 && helix_field_tol < 1);
         // clang-format on
     }
 };
@@ -111,6 +115,7 @@ constexpr bool operator==(FieldDriverOptions const& a,
            && a.max_stepping_decrease == b.max_stepping_decrease
            && a.max_nsteps == b.max_nsteps
            && a.max_substeps == b.max_substeps
+           && a.helix_field_tol == b.helix_field_tol
            && a.initial_step_tol == b.initial_step_tol
            && a.dchord_tol == b.dchord_tol
            && a.min_chord_shrink == b.min_chord_shrink;
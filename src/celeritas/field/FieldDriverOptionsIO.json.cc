@@ -42,6 +42,7 @@ void from_json(nlohmann::json const& j, FieldDriverOptions& opts)
     FDO_INPUT(max_stepping_decrease);
     FDO_INPUT(max_nsteps);
     FDO_INPUT(max_substeps);
+    FDO_INPUT(helix_field_tol);
 
 #undef FDO_INPUT
 }
@@ -66,6 +67,7 @@ void to_json(nlohmann::json& j, FieldDriverOptions const& opts)
         CELER_JSON_PAIR(opts, max_stepping_decrease),
         CELER_JSON_PAIR(opts, max_nsteps),
         CELER_JSON_PAIR(opts, max_substeps),
+        CELER_JSON_PAIR(opts, helix_field_tol),
     };
 
     save_format(j, format_str);
@@ -61,6 +61,15 @@ class MagFieldEquation
     // Evaluate the right hand side of the field equation
     inline CELER_FUNCTION OdeState operator()(OdeState const& y) const;
 
+    //! Evaluate the magnetic field at a position
+    CELER_FUNCTION decltype(auto) calc_field(OdeState::Real3 const& pos) const
+    {
+        return calc_field_(pos);
+    }
+
+    //! Lorentz coefficient (charge) in 1/OdeState::MomentumUnits
+    CELER_FUNCTION real_type coeffi() const { return coeffi_; }
+
   private:
     // Field evaluator
     Field_t calc_field_;
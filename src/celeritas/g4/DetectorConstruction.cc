@@ -70,7 +70,8 @@ G4VPhysicalVolume* DetectorConstruction::Construct()
 
     // Create non-owning Geant4 geo wrapper and save as tracking geometry
     CELER_ASSERT(loaded.world);
-    geo_ = std::make_shared<GeantGeoParams>(loaded.world, Ownership::reference);
+    geo_ = std::make_shared<GeantGeoParams>(
+        loaded.world, Ownership::reference, filename_);
     celeritas::global_geant_geo(geo_);
 
     // Save detectors
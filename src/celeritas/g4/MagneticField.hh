@@ -6,7 +6,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <G4MagneticField.hh>
 
 #include "corecel/Assert.hh"
@@ -22,6 +24,12 @@ namespace celeritas
 /*!
  * Wrap a Celeritas field as a Geant4 magnetic field.
  *
+ * The field calculator is constructed once per thread and reused across calls
+ * to \c GetFieldValue, so that any state it keeps between evaluations (such
+ * as the cached grid cell of \c CylMapField) persists over a Geant4 step.
+ * It is stored in thread-local storage keyed on a unique ID for each
+ * instance, since Geant4 may share a field between worker threads.
+ *
  * \tparam P params for creating field
  * \tparam F field calculator
  */
@@ -43,7 +51,24 @@ class MagneticField : public G4MagneticField
                               G4double* field) const override;
 
   private:
+    //// TYPES ////
+
+    //! Field calculator for the most recently used instance on this thread
+    struct ThreadField
+    {
+        unsigned long long owner{0};
+        std::optional<F> calc;
+    };
+
+    //// DATA ////
+
     SPConstParams params_;
+    unsigned long long id_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Get the field calculator for this instance on the current thread
+    inline F const& thread_field() const;
 };
 
 //---------------------------------------------------------------------------//
@@ -57,6 +82,10 @@ MagneticField<P, F>::MagneticField(SPConstParams params)
     : params_(std::move(params))
 {
     CELER_EXPECT(params_);
+
+    // Start at 1 so that zero denotes an unassigned thread field
+    static std::atomic<unsigned long long> next_id{1};
+    id_ = next_id++;
 }
 
 //---------------------------------------------------------------------------//
@@ -67,7 +96,7 @@ template<class P, class F>
 void MagneticField<P, F>::GetFieldValue(G4double const xyzt[4],
                                         G4double* field) const
 {
-    F calc_field{params_->host_ref()};
+    F const& calc_field = this->thread_field();
 
     // Get the g4 position
     Span<G4double const, 3> pos(xyzt, 3);
@@ -82,5 +111,25 @@ void MagneticField<P, F>::GetFieldValue(G4double const xyzt[4],
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the field calculator for this instance on the current thread.
+ *
+ * The calculator is rebuilt only if a different field instance was last
+ * evaluated on this thread.
+ */
+template<class P, class F>
+F const& MagneticField<P, F>::thread_field() const
+{
+    static thread_local ThreadField tf;
+    if (tf.owner != id_)
+    {
+        tf.calc.emplace(F{params_->host_ref()});
+        tf.owner = id_;
+    }
+    CELER_ENSURE(tf.calc);
+    return *tf.calc;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -12,9 +12,11 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "ActionInterface.hh"
 #include "CoreParams.hh"
@@ -25,12 +27,13 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Helper function to run an executor in parallel on CPU.
+ * Helper function to run an executor in parallel on CPU over a thread range.
  *
- * This allows using a custom number of threads rather than the state size.
+ * This is used to launch only the threads whose (sorted) tracks are about to
+ * undergo a particular action.
  */
 template<class F>
-void launch_core(size_type num_threads,
+void launch_core(Range<ThreadId> threads,
                  std::string_view label,
                  celeritas::CoreParams const& params,
                  celeritas::CoreState<MemSpace::host>& state,
@@ -38,10 +41,12 @@ void launch_core(size_type num_threads,
 {
     ScopedProfiling profile_this_{label};
     MultiExceptionHandler capture_exception;
+    size_type const begin = threads.begin()->unchecked_get();
+    size_type const end = threads.end()->unchecked_get();
 #if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
 #    pragma omp parallel for
 #endif
-    for (size_type i = 0; i < num_threads; ++i)
+    for (size_type i = begin; i < end; ++i)
     {
         CELER_TRY_HANDLE_CONTEXT(
             execute_thread(ThreadId{i}),
@@ -52,6 +57,26 @@ void launch_core(size_type num_threads,
     log_and_rethrow(std::move(capture_exception));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function to run an executor in parallel on CPU.
+ *
+ * This allows using a custom number of threads rather than the state size.
+ */
+template<class F>
+void launch_core(size_type num_threads,
+                 std::string_view label,
+                 celeritas::CoreParams const& params,
+                 celeritas::CoreState<MemSpace::host>& state,
+                 F&& execute_thread)
+{
+    return launch_core(range(ThreadId{num_threads}),
+                       label,
+                       params,
+                       state,
+                       std::forward<F>(execute_thread));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Helper function to run an executor in parallel on CPU over all states.
@@ -99,6 +124,10 @@ void launch_action(CoreStepActionInterface const& action,
 /*!
  * Helper function to run an action in parallel on CPU over all states.
  *
+ * If tracks are sorted by action before this action is applied, only the
+ * threads in the action's partition are launched. These arguments should be
+ * consistent with those in \c ActionLauncher.device.hh .
+ *
  * Example:
  * \code
  void FooAction::step(CoreParams const& params,
@@ -114,8 +143,24 @@ void launch_action(CoreStepActionInterface const& action,
                    celeritas::CoreState<MemSpace::host>& state,
                    F&& execute_thread)
 {
-    return launch_core(
-        action.label(), params, state, std::forward<F>(execute_thread));
+    if (state.has_action_range()
+        && is_action_sorted(action.order(), params.init()->track_order()))
+    {
+        // Launch on the subset of threads assigned to this action
+        auto threads = state.get_action_range(action.action_id());
+        state.count_action_launch(threads);
+        return launch_core(threads,
+                           action.label(),
+                           params,
+                           state,
+                           std::forward<F>(execute_thread));
+    }
+    else
+    {
+        // Not partitioned by action: launch on all threads
+        return launch_core(
+            action.label(), params, state, std::forward<F>(execute_thread));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -9,13 +9,11 @@
 #include <algorithm>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
 #include "corecel/DeviceRuntimeApi.hh"
 
 #include "corecel/Types.hh"
 #include "corecel/cont/EnumArray.hh"
-#include "corecel/cont/Range.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "corecel/sys/Device.hh"
@@ -81,12 +79,10 @@ void ActionSequence::step(CoreParams const& params, CoreState<M>& state)
     Stopwatch get_step_time;
 
     // Save a pointer to aux data for timing actions
-    // NOTE: instead of synchronizing the stream we could add device timers to
-    // reduce the performance impact
-    std::vector<double>* accum_time = nullptr;
-    if (options_.action_times)
+    ActionTimesState* action_times = nullptr;
+    if (options_.action_times && !state.warming_up())
     {
-        accum_time = &options_.action_times->state(state.aux()).accum_time;
+        action_times = &options_.action_times->state(state.aux());
     }
 
     // When running a single track slot on host, we can preemptively skip
@@ -101,29 +97,25 @@ void ActionSequence::step(CoreParams const& params, CoreState<M>& state)
                       != state.ref().sim.post_step_action[TrackSlotId{0}];
     };
 
-    auto step_actions = make_span(actions_.step());
-    if (options_.action_times && !state.warming_up())
+    if (action_times)
     {
         // Execute all actions and record the time elapsed
-        for (auto i : range(step_actions.size()))
+        action_times->mark();
+        for (auto const& sp_action : actions_.step())
         {
-            if (auto const& action = *step_actions[i];
-                !skip_post_action(action))
+            if (auto const& action = *sp_action; !skip_post_action(action))
             {
                 ScopedProfiling profile_this{action.label()};
-                Stopwatch get_action_time;
                 action.step(params, state);
-                if (M == MemSpace::device)
-                {
-                    device().stream(state.stream_id()).sync();
-                }
-                (*accum_time)[action.action_id().get()] += get_action_time();
+                action_times->record(action.action_id());
                 if (CELER_UNLIKELY(status_checker_))
                 {
                     status_checker_->step(action.action_id(), params, state);
+                    action_times->mark();
                 }
             }
         }
+        action_times->end_step();
     }
     else
     {
@@ -48,7 +48,7 @@ class ActionSequence
     //! Construction/execution options
     struct Options
     {
-        SPActionTimes action_times;  //!< Call DeviceSynchronize and add timer
+        SPActionTimes action_times;  //!< Accumulate time for each action
         SPStepTimes step_times;
     };
 
@@ -268,6 +268,7 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
         case TrackOrder::reindex_step_limit_action:
         case TrackOrder::reindex_along_step_action:
         case TrackOrder::reindex_particle_type:
+        case TrackOrder::reindex_volume:
             // Sort with just the given track order
             insert_sort_tracks_action(track_order);
             break;
@@ -6,9 +6,14 @@
 //---------------------------------------------------------------------------//
 #include "CoreState.hh"
 
+#include <utility>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/ActionRegistry.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
+#include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
 
 #include "CoreParams.hh"
@@ -39,6 +44,22 @@ CoreState<M>::CoreState(CoreParams const& params, StreamId stream_id)
 template<MemSpace M>
 CoreState<M>::CoreState(
     CoreParams const& params, StreamId stream_id, size_type num_track_slots)
+    : CoreState{params, stream_id, num_track_slots, StateLayout::soa}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with manual slot count and state memory layout.
+ *
+ * The tiled \c StateLayout::aosoa layout is intended for host transport of
+ * large states: see \c StateLayout .
+ */
+template<MemSpace M>
+CoreState<M>::CoreState(CoreParams const& params,
+                        StreamId stream_id,
+                        size_type num_track_slots,
+                        StateLayout layout)
 {
     CELER_VALIDATE(stream_id < params.sizes().streams,
                    << "stream ID " << stream_id.unchecked_get()
@@ -46,10 +67,13 @@ CoreState<M>::CoreState(
                    << params.sizes().streams);
     CELER_VALIDATE(num_track_slots > 0, << "number of track slots is not set");
 
-    ScopedProfiling profile_this{"construct-state"};
+    ScopedSetupPhase record_phase{"construct-state"};
 
-    states_ = StateDataStore<CoreStateData, M>(
-        params.host_ref(), stream_id, num_track_slots);
+    {
+        CoreStateData<Ownership::value, M> states;
+        resize(&states, params.host_ref(), stream_id, num_track_slots, layout);
+        states_ = StateDataStore<CoreStateData, M>(std::move(states));
+    }
 
     auto counters = CoreStateCounters{};
     counters.num_vacancies = num_track_slots;
@@ -78,6 +102,8 @@ CoreState<M>::CoreState(
         offsets_.resize(params.action_reg()->num_actions() + 1);
     }
 
+    physics_ = params.physics();
+
     CELER_LOG(status) << "Celeritas core state initialization complete";
     CELER_ENSURE(states_);
     CELER_ENSURE(ptr_);
@@ -86,7 +112,11 @@ CoreState<M>::CoreState(
 
 //---------------------------------------------------------------------------//
 /*!
- * Print diagnostic when core state is being deleted.
+ * Accumulate diagnostics into params and deallocate.
+ *
+ * If enabled, cross section cache counters are summed over track slots and
+ * added to the physics params so that they can be written with the physics
+ * output.
  */
 template<MemSpace M>
 CoreState<M>::~CoreState()
@@ -96,10 +126,32 @@ CoreState<M>::~CoreState()
         CELER_LOG(debug) << "Deallocating " << to_cstring(M)
                          << " core state (stream "
                          << this->stream_id().unchecked_get() << ')';
+
+        if (launch_counts_.visited + launch_counts_.skipped > 0)
+        {
+            CELER_LOG(debug) << "Action-range launches visited "
+                             << launch_counts_.visited << " track slots and "
+                             << "skipped " << launch_counts_.skipped;
+        }
+
+        if (physics_ && states_
+            && physics_->host_ref().scalars.count_xs_cache)
+        {
+            auto const& phys_state = this->ref().physics;
+            auto hits = copy_to_host(phys_state.xs_cache_hits);
+            auto misses = copy_to_host(phys_state.xs_cache_misses);
+            XsCacheCounts counts;
+            for (auto tid : range(TrackSlotId{hits.size()}))
+            {
+                counts.hits += hits[tid];
+                counts.misses += misses[tid];
+            }
+            physics_->add_xs_cache_counts(counts);
+        }
     }
     catch (...)  // NOLINT(bugprone-empty-catch)
     {
-        // Ignore anything bad that happens while logging
+        // Ignore anything bad that happens while logging or copying
     }
 }
 
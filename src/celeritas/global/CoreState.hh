@@ -6,6 +6,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "corecel/Types.hh"
@@ -18,6 +19,7 @@
 #include "corecel/data/StateDataStore.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/track/CoreStateCounters.hh"
+#include "celeritas/track/detail/TrackSortScratch.hh"
 
 #include "CoreTrackData.hh"
 
@@ -26,6 +28,21 @@
 namespace celeritas
 {
 class CoreParams;
+class PhysicsParams;
+//---------------------------------------------------------------------------//
+/*!
+ * Number of track slots visited and skipped by action-range launches.
+ *
+ * When tracks are sorted by action, the host launcher runs each action only
+ * over its partition of the sorted track slots. The skipped count is the
+ * number of slot visits saved relative to launching over the full state.
+ */
+struct ActionLaunchCounts
+{
+    size_type visited{0};  //!< Track slots executed
+    size_type skipped{0};  //!< Track slots outside the action's range
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Abstract base class for CoreState.
@@ -101,7 +118,13 @@ class CoreState final : public CoreStateInterface
               StreamId stream_id,
               size_type num_track_slots);
 
-    // Default destructor
+    // Construct with manual slot count and state memory layout
+    CoreState(CoreParams const& params,
+              StreamId stream_id,
+              size_type num_track_slots,
+              StateLayout layout);
+
+    // Accumulate diagnostics into params and deallocate
     ~CoreState() final;
 
     // Prevent move/copy
@@ -175,6 +198,18 @@ class CoreState final : public CoreStateInterface
     // Access action offsets for computation (native memory space)
     inline auto& native_action_thread_offsets();
 
+    //! Access reusable host storage for sorting tracks
+    detail::TrackSortScratch& sort_scratch() { return sort_scratch_; }
+
+    // Record an action launch restricted to a range of sorted track slots
+    inline void count_action_launch(Range<ThreadId> const& threads);
+
+    //! Slots visited and skipped by action-range launches
+    ActionLaunchCounts const& action_launch_counts() const
+    {
+        return launch_counts_;
+    }
+
   private:
     // State data
     StateDataStore<CoreStateData, M> states_;
@@ -191,8 +226,17 @@ class CoreState final : public CoreStateInterface
     // Indices of first thread assigned to a given action
     detail::CoreStateThreadOffsets<M> offsets_;
 
+    // Slots visited and skipped by action-range launches
+    ActionLaunchCounts launch_counts_;
+
+    // Temporary storage for host track sorting
+    detail::TrackSortScratch sort_scratch_;
+
     // Whether no primaries should be generated
     bool warming_up_{false};
+
+    // Physics params for accumulating cross section cache counters
+    std::shared_ptr<PhysicsParams const> physics_;
 };
 
 //---------------------------------------------------------------------------//
@@ -243,6 +287,18 @@ auto& CoreState<M>::native_action_thread_offsets()
     return offsets_.native_action_thread_offsets();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Record an action launch restricted to a range of sorted track slots.
+ */
+template<MemSpace M>
+void CoreState<M>::count_action_launch(Range<ThreadId> const& threads)
+{
+    CELER_EXPECT(threads.size() <= this->size());
+    launch_counts_.visited += threads.size();
+    launch_counts_.skipped += this->size() - threads.size();
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
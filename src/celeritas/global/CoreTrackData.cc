@@ -21,15 +21,24 @@ template<MemSpace M>
 void resize(CoreStateData<Ownership::value, M>* state,
             HostCRef<CoreParamsData> const& params,
             StreamId stream_id,
-            size_type size)
+            size_type size,
+            StateLayout layout)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(stream_id);
     CELER_EXPECT(size > 0);
+    CELER_EXPECT(layout != StateLayout::size_);
     CELER_VALIDATE(stream_id < params.scalars.max_streams,
                    << "multitasking stream_id=" << stream_id.unchecked_get()
                    << " exceeds max_streams=" << params.scalars.max_streams);
-#if CELERITAS_CORE_GEO != CELERITAS_CORE_GEO_GEANT4
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+    // Tile eight slots so each level's position fills three cache lines
+    constexpr size_type aosoa_log2_tile{3};
+    resize(&state->geometry,
+           params.geometry,
+           size,
+           layout == StateLayout::aosoa ? aosoa_log2_tile : 0);
+#elif CELERITAS_CORE_GEO != CELERITAS_CORE_GEO_GEANT4
     resize(&state->geometry, params.geometry, size);
 #else
     // Geant4 state is stream-local
@@ -63,13 +72,15 @@ template void resize<MemSpace::host>(
     CoreStateData<Ownership::value, MemSpace::host>*,
     HostCRef<CoreParamsData> const&,
     StreamId,
-    size_type);
+    size_type,
+    StateLayout);
 
 template void resize<MemSpace::device>(
     CoreStateData<Ownership::value, MemSpace::device>*,
     HostCRef<CoreParamsData> const&,
     StreamId,
-    size_type);
+    size_type,
+    StateLayout);
 
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
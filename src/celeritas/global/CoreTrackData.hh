@@ -174,13 +174,28 @@ struct CoreStateData
  * Resize states in host code.
  *
  * Initialize threads to track slots mapping.
- * Resize core states using parameter data, stream ID, and track slots.
+ * Resize core states using parameter data, stream ID, track slots, and the
+ * memory layout of multi-entry track data.
  */
 template<MemSpace M>
 void resize(CoreStateData<Ownership::value, M>* state,
             HostCRef<CoreParamsData> const& params,
             StreamId stream_id,
-            size_type size);
+            size_type size,
+            StateLayout layout);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize states in host code with the default layout.
+ */
+template<MemSpace M>
+inline void resize(CoreStateData<Ownership::value, M>* state,
+                   HostCRef<CoreParamsData> const& params,
+                   StreamId stream_id,
+                   size_type size)
+{
+    return resize(state, params, stream_id, size, StateLayout::soa);
+}
 
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -81,7 +81,7 @@ Stepper<M>::Stepper(Input input)
                       "stepper input");
     // Create state, including aux data
     state_ = std::make_shared<CoreState<M>>(
-        *params_, input.stream_id, track_slots);
+        *params_, input.stream_id, track_slots, input.layout);
 
     // Execute beginning-of-run action
     ScopedProfiling profile_this{"begin-run"};
@@ -38,7 +38,8 @@ class ExtendFromPrimariesAction;
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  *   (optional, could be set by params)
  *   \c stream_id : Unique (thread/task) ID for this process
- * - \c action_times : Whether to synchronize device between actions for timing
+ * - \c actions : Action sequence, optionally with action and step timers
+ * - \c layout : Memory layout of multi-entry track state data
  */
 struct StepperInput
 {
@@ -46,6 +47,7 @@ struct StepperInput
     std::shared_ptr<ActionSequence> actions;
     StreamId stream_id{};
     size_type num_track_slots{};
+    StateLayout layout{StateLayout::soa};
 
     //! True if defined
     explicit operator bool() const { return params && actions && stream_id; }
@@ -118,12 +118,12 @@ struct OpticalStateCapacity : StateCapacity
 /*!
  * When using GPU, change execution options that make it easier to debug.
  *
- * Defaults:
- * - \c sync_stream: \c false unless \c timers.diagnostics.action is \c true.
+ * Action times are measured with device events when \c sync_stream is
+ * disabled, so timing can be left on in production runs.
  */
 struct DeviceDebug
 {
-    //! Synchronize the stream after every kernel launch
+    //! Synchronize the stream after every timed action
     bool sync_stream{false};
 };
 
@@ -77,6 +77,8 @@ struct Counters
     bool step{true};
     //! Write diagnostics for each event (or run, if multiple events)
     bool event{true};
+    //! Count steps that reuse the previous step's physics cross sections
+    bool xs_cache{false};
 };
 
 //---------------------------------------------------------------------------//
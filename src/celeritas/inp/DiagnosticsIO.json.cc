@@ -62,6 +62,7 @@ void to_json(nlohmann::json& j, Counters const& v)
     j = nlohmann::json{
         CELER_JSON_PAIR(v, step),
         CELER_JSON_PAIR(v, event),
+        CELER_JSON_PAIR(v, xs_cache),
     };
 }
 
@@ -69,6 +70,7 @@ void from_json(nlohmann::json const& j, Counters& v)
 {
     CELER_JSON_LOAD_OPTION(j, v, step);
     CELER_JSON_LOAD_OPTION(j, v, event);
+    CELER_JSON_LOAD_OPTION(j, v, xs_cache);
 }
 
 void to_json(nlohmann::json& j, McTruth const& v)
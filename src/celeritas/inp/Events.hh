@@ -229,6 +229,10 @@ struct Events
     Generator generator;
     //! Whether to run all events at once on a single stream
     bool merge{false};
+    //! Transport events with the largest total primary energy first
+    bool largest_first{false};
+    //! Stream events with at most this many read ahead (0: load all first)
+    size_type prefetch{0};
 };
 
 //---------------------------------------------------------------------------//
@@ -207,6 +207,8 @@ void to_json(nlohmann::json& j, Events const& v)
     j = nlohmann::json{
         CELER_JSON_PAIR(v, generator),
         CELER_JSON_PAIR(v, merge),
+        CELER_JSON_PAIR(v, largest_first),
+        CELER_JSON_PAIR(v, prefetch),
     };
 }
 
@@ -214,6 +216,8 @@ void from_json(nlohmann::json const& j, Events& v)
 {
     CELER_JSON_LOAD_REQUIRED(j, v, generator);
     CELER_JSON_LOAD_OPTION(j, v, merge);
+    CELER_JSON_LOAD_OPTION(j, v, largest_first);
+    CELER_JSON_LOAD_OPTION(j, v, prefetch);
 }
 
 //!@}
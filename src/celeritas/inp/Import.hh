@@ -54,6 +54,16 @@ struct PhysicsFromGeant
 
     //! Only import a subset of available Geant4 data
     GeantImportDataSelection data_selection;
+
+    /*!
+     * Binary file for caching imported physics data between runs.
+     *
+     * If nonempty and the file was written from identical geometry and
+     * physics inputs, the data (including that loaded from Geant4 data files)
+     * is read from it and Geant4 physics is not constructed. Otherwise the
+     * data is imported and the file is (re)written.
+     */
+    std::string cache_file;
 };
 
 //---------------------------------------------------------------------------//
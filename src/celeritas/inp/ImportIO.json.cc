@@ -49,6 +49,7 @@ void to_json(nlohmann::json& j, PhysicsFromGeant const& v)
         json_type_pair("geant"),
         CELER_JSON_PAIR(v, ignore_processes),
         CELER_JSON_PAIR(v, data_selection),
+        CELER_JSON_PAIR(v, cache_file),
     };
 }
 
@@ -56,6 +57,7 @@ void from_json(nlohmann::json const& j, PhysicsFromGeant& v)
 {
     CELER_JSON_LOAD_OPTION(j, v, ignore_processes);
     CELER_JSON_LOAD_OPTION(j, v, data_selection);
+    CELER_JSON_LOAD_OPTION(j, v, cache_file);
 }
 
 void to_json(nlohmann::json& j, PhysicsImport const& v)
@@ -92,6 +92,8 @@ struct OpticalProblem
     OpticalGenerator generator;
     //! Hard cutoffs for counters
     OpticalTrackingLimits limits;
+    //! Variance reduction for optical photons (photon scaling is unsupported)
+    OpticalBiasing biasing;
     //! Per-process state sizes for optical tracking loop
     OpticalStateCapacity capacity;
     //! User scoring configuration for optical detectors
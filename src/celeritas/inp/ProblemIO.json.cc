@@ -54,6 +54,7 @@ void to_json(nlohmann::json& j, OpticalProblem const& v)
         CELER_JSON_PAIR(v, model),
         CELER_JSON_PAIR(v, generator),
         CELER_JSON_PAIR(v, limits),
+        CELER_JSON_PAIR(v, biasing),
         CELER_JSON_PAIR(v, capacity),
         CELER_JSON_PAIR(v, seed),
         CELER_JSON_PAIR(v, timers),
@@ -68,6 +69,7 @@ void from_json(nlohmann::json const& j, OpticalProblem& v)
     CELER_JSON_LOAD_REQUIRED(j, v, model);
     CELER_JSON_LOAD_REQUIRED(j, v, generator);
     CELER_JSON_LOAD_OPTION(j, v, limits);
+    CELER_JSON_LOAD_OPTION(j, v, biasing);
     CELER_JSON_LOAD_OPTION(j, v, capacity);
     CELER_JSON_LOAD_OPTION(j, v, seed);
     CELER_JSON_LOAD_OPTION(j, v, timers);
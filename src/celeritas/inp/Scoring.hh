@@ -85,6 +85,14 @@ struct GeantSdStepPointAttributes
  * FindVolumes helper function can be used to determine LV pointers from
  * the volume names.
  *
+ * The \c async option copies each step's hits into one of two alternating
+ * host buffers and sends them to the sensitive detectors from a helper thread
+ * while the next step is transported. It requires \c track and both \c
+ * touchable options to be disabled, and every detector must implement \c
+ * GeantSdBatchInterface without relying on thread-local Geant4 state such as
+ * \c G4Allocator or the event manager (e.g., by accumulating into its own
+ * storage).
+ *
  * \todo For improved granularity in models with duplicate names, we could add
  * a vector of \c Label to \c VariantSetVolume .
  * \todo change from \c unordered_set to \c set for better reproducibility in
@@ -113,6 +121,8 @@ struct GeantSd
     bool step_length{true};
     //! Create a track with the dynamic particle type and post-step data
     bool track{true};
+    //! Call detectors from a helper thread while transport continues
+    bool async{false};
 
     //! Options for saving and converting beginning- and end-of-step data
     PointAttrs points;
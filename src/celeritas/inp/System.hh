@@ -43,6 +43,10 @@ struct Device
 /*!
  * Set up system parameters defined once at program startup.
  *
+ * Sharing params places the host copy of all immutable params data in POSIX
+ * shared memory, built by one process and referenced by all the others on the
+ * same node: see \c SharedHostParams .
+ *
  * \todo Add OpenMP options
  * \todo Add MPI options
  * \todo Add Logger verbosity
@@ -54,6 +58,9 @@ struct System
 
     //! Optional: activate GPU
     std::optional<Device> device;
+
+    //! Share host params data among MPI processes on each node
+    bool share_params{false};
 };
 
 //---------------------------------------------------------------------------//
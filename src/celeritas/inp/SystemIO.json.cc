@@ -35,6 +35,7 @@ void to_json(nlohmann::json& j, System const& v)
     j = nlohmann::json{
         CELER_JSON_PAIR(v, environment),
         CELER_JSON_PAIR_OPTIONAL(v, device),
+        CELER_JSON_PAIR(v, share_params),
     };
 }
 
@@ -42,6 +43,7 @@ void from_json(nlohmann::json const& j, System& v)
 {
     CELER_JSON_LOAD_OPTION(j, v, environment);
     CELER_JSON_LOAD_OPTIONAL(j, v, device);
+    CELER_JSON_LOAD_OPTION(j, v, share_params);
 }
 
 //!@}
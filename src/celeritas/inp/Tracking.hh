@@ -46,9 +46,44 @@ struct CoreTrackingLimits : TrackingLimits
 //---------------------------------------------------------------------------//
 /*!
  * Tracking limits for the optical stepping loop.
+ *
+ * By default, pending optical tracks are transported to completion each time
+ * the optical loop is launched, which stalls the core stepping loop. If \c
+ * interleave_step_iters is nonzero, once the optical loop starts it instead
+ * takes at most that many step iterations per core step, so that the two
+ * loops progress together. Any remaining optical tracks are transported to
+ * completion when the core loop runs out of tracks.
  */
 struct OpticalTrackingLimits : TrackingLimits
 {
+    //! Optical step iterations per core step (zero to flush to completion)
+    size_type interleave_step_iters{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Variance reduction for optical photons.
+ *
+ * If \c photon_scale is greater than one, each optical photon generated in
+ * the main stepping loop represents \c photon_scale physical photons: the
+ * sampled number of photons is divided by the scale (rounding stochastically
+ * so that the expected number is preserved) and each photon carries the
+ * scale as its statistical weight.
+ *
+ * If \c roulette_steps is nonzero, Russian roulette is played every time a
+ * photon takes that many steps: it survives with probability \c
+ * roulette_survival and its weight is divided by the survival probability.
+ * Detector hits record the weight so that the scored quantities remain
+ * unbiased.
+ */
+struct OpticalBiasing
+{
+    //! Physical photons represented by each generated photon
+    real_type photon_scale{1};
+    //! Number of steps between roulette games (zero to disable)
+    size_type roulette_steps{0};
+    //! Probability of surviving a roulette game
+    real_type roulette_survival{0.5};
 };
 
 //---------------------------------------------------------------------------//
@@ -61,6 +96,8 @@ struct Tracking
     CoreTrackingLimits limits;
     //! Limits for the optical stepping loop
     OpticalTrackingLimits optical_limits;
+    //! Variance reduction for optical photons
+    OpticalBiasing optical_biasing;
 
     //! Hardcoded maximum step for debugging charged particles (none if zero)
     real_type force_step_limit{};
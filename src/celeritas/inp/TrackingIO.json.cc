@@ -37,6 +37,7 @@ void to_json(nlohmann::json& j, OpticalTrackingLimits const& v)
     j = nlohmann::json{
         CELER_JSON_PAIR(v, steps),
         CELER_JSON_PAIR(v, step_iters),
+        CELER_JSON_PAIR(v, interleave_step_iters),
     };
 }
 
@@ -44,6 +45,23 @@ void from_json(nlohmann::json const& j, OpticalTrackingLimits& v)
 {
     CELER_JSON_LOAD_OPTION(j, v, steps);
     CELER_JSON_LOAD_OPTION(j, v, step_iters);
+    CELER_JSON_LOAD_OPTION(j, v, interleave_step_iters);
+}
+
+void to_json(nlohmann::json& j, OpticalBiasing const& v)
+{
+    j = nlohmann::json{
+        CELER_JSON_PAIR(v, photon_scale),
+        CELER_JSON_PAIR(v, roulette_steps),
+        CELER_JSON_PAIR(v, roulette_survival),
+    };
+}
+
+void from_json(nlohmann::json const& j, OpticalBiasing& v)
+{
+    CELER_JSON_LOAD_OPTION(j, v, photon_scale);
+    CELER_JSON_LOAD_OPTION(j, v, roulette_steps);
+    CELER_JSON_LOAD_OPTION(j, v, roulette_survival);
 }
 
 void to_json(nlohmann::json& j, Tracking const& v)
@@ -51,6 +69,7 @@ void to_json(nlohmann::json& j, Tracking const& v)
     j = nlohmann::json{
         CELER_JSON_PAIR(v, limits),
         CELER_JSON_PAIR(v, optical_limits),
+        CELER_JSON_PAIR(v, optical_biasing),
         CELER_JSON_PAIR(v, force_step_limit),
     };
 }
@@ -59,6 +78,7 @@ void from_json(nlohmann::json const& j, Tracking& v)
 {
     CELER_JSON_LOAD_OPTION(j, v, limits);
     CELER_JSON_LOAD_OPTION(j, v, optical_limits);
+    CELER_JSON_LOAD_OPTION(j, v, optical_biasing);
     CELER_JSON_LOAD_OPTION(j, v, force_step_limit);
 }
 
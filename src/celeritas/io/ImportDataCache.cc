@@ -0,0 +1,585 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportDataCache.cc
+//---------------------------------------------------------------------------//
+#include "ImportDataCache.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/io/BinaryArchive.hh"
+#include "corecel/io/BinaryFile.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/ScopedProfiling.hh"
+#include "celeritas/inp/MucfPhysics.hh"
+#include "celeritas/inp/OpticalPhysics.hh"
+#include "celeritas/inp/PhysicsProcess.hh"
+
+#include "ImportAtomicRelaxation.hh"
+
+namespace celeritas
+{
+namespace inp
+{
+//---------------------------------------------------------------------------//
+// GRIDS AND DISTRIBUTIONS
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, Interpolation& v)
+{
+    ar(v.type, v.order, v.bc);
+}
+
+template<class Ar>
+void serialize(Ar& ar, Grid& v)
+{
+    ar(v.x, v.y, v.interpolation);
+}
+
+template<class Ar>
+void serialize(Ar& ar, UniformGrid& v)
+{
+    ar(v.x, v.y, v.interpolation);
+}
+
+template<class Ar>
+void serialize(Ar& ar, TwodGrid& v)
+{
+    ar(v.x, v.y, v.value);
+}
+
+template<class Ar>
+void serialize(Ar& ar, NormalDistribution& v)
+{
+    ar(v.mean, v.stddev);
+}
+
+//---------------------------------------------------------------------------//
+// PARTICLES AND MODELS
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, Particle& v)
+{
+    ar(v.name, v.pdg, v.mass, v.charge, v.decay_constant);
+}
+
+template<class Ar>
+void serialize(Ar& ar, SeltzerBergerModel& v)
+{
+    ar(v.atomic_xs);
+}
+
+template<class Ar>
+void serialize(Ar& ar, MuPairProductionEnergyTransferTable& v)
+{
+    ar(v.atomic_number, v.grids);
+}
+
+template<class Ar>
+void serialize(Ar& ar, MuPairProductionModel& v)
+{
+    ar(v.muppet_table);
+}
+
+template<class Ar>
+void serialize(Ar& ar, LivermorePhotoModel& v)
+{
+    ar(v.atomic_xs);
+}
+
+template<class Ar>
+void serialize(Ar& ar, AtomicRelaxation& v)
+{
+    ar(v.atomic_xs);
+}
+
+//---------------------------------------------------------------------------//
+// MUON-CATALYZED FUSION
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, MucfScalars& v)
+{
+    ar(v.protium, v.deuterium, v.tritium, v.liquid_hydrogen_density);
+}
+
+template<class Ar>
+void serialize(Ar& ar, MucfCycleRate& v)
+{
+    ar(v.type, v.rate, v.spin_state);
+}
+
+template<class Ar>
+void serialize(Ar& ar, MucfPhysics& v)
+{
+    ar(v.scalars,
+       v.muon_energy_cdf,
+       v.cycle_rates,
+       v.atom_transfer,
+       v.atom_spin_flip);
+}
+
+//---------------------------------------------------------------------------//
+// OPTICAL PHYSICS
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, CherenkovStepLimit& v)
+{
+    ar(v.max_speed_loss, v.max_photons);
+}
+
+template<class Ar>
+void serialize(Ar& ar, CherenkovProcess& v)
+{
+    ar(v.step_limit);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ScintillationSpectrum& v)
+{
+    ar(v.yield,
+       v.rise_time,
+       v.fall_time,
+       v.spectrum_distribution,
+       v.spectrum_argument);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ScintillationMaterial& v)
+{
+    ar(v.components, v.resolution_scale);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ScintillationProcess& v)
+{
+    ar(v.materials);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalGenPhysics& v)
+{
+    ar(v.cherenkov, v.scintillation);
+}
+
+template<class Ar>
+void serialize(Ar& ar, AbsorptionMaterial& v)
+{
+    ar(v.mfp);
+}
+
+template<class Ar>
+void serialize(Ar& ar, MieMaterial& v)
+{
+    ar(v.forward_g, v.backward_g, v.forward_ratio, v.mfp);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalRayleighAnalytic& v)
+{
+    ar(v.scale_factor, v.compressibility);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalRayleighMaterial& v)
+{
+    ar(v.mfp);
+}
+
+template<class Ar>
+void serialize(Ar& ar, WavelengthShiftMaterial& v)
+{
+    ar(v.mean_num_photons, v.time_constant, v.component, v.mfp);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalBulkAbsorption& v)
+{
+    ar(v.materials);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalBulkMie& v)
+{
+    ar(v.materials);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalBulkRayleigh& v)
+{
+    ar(v.materials);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalBulkWavelengthShift& v)
+{
+    ar(v.materials, v.time_profile);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalBulkPhysics& v)
+{
+    ar(v.absorption, v.mie, v.rayleigh, v.wls, v.wls2);
+}
+
+template<class Ar>
+void serialize(Ar& ar, GridReflection& v)
+{
+    ar(v.reflectivity, v.transmittance, v.efficiency);
+}
+
+template<class Ar>
+void serialize(Ar& ar, SmearRoughness& v)
+{
+    ar(v.roughness);
+}
+
+template<class Ar>
+void serialize(Ar& ar, GaussianRoughness& v)
+{
+    ar(v.sigma_alpha);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ReflectionForm& v)
+{
+    ar(v.reflection_grids);
+}
+
+template<class Ar>
+void serialize(Ar& ar, DielectricInteraction& v)
+{
+    ar(v.reflection, v.is_metal);
+}
+
+template<class Ar>
+void serialize(Ar& ar, RoughnessModels& v)
+{
+    ar(v.polished, v.smear, v.gaussian);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ReflectivityModels& v)
+{
+    ar(v.grid, v.fresnel);
+}
+
+template<class Ar>
+void serialize(Ar& ar, InteractionModels& v)
+{
+    ar(v.dielectric, v.trivial, v.only_reflection);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalSurfacePhysics& v)
+{
+    ar(v.materials, v.roughness, v.reflectivity, v.interaction);
+}
+
+template<class Ar>
+void serialize(Ar& ar, OpticalPhysics& v)
+{
+    ar(v.gen, v.bulk, v.surfaces);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace inp
+
+//---------------------------------------------------------------------------//
+// IDENTIFIERS
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, AtomicNumber& v)
+{
+    int value = v.unchecked_get();
+    ar(value);
+    if constexpr (Ar::is_loading)
+    {
+        v = AtomicNumber{value};
+    }
+}
+
+template<class Ar>
+void serialize(Ar& ar, PDGNumber& v)
+{
+    int value = v.unchecked_get();
+    ar(value);
+    if constexpr (Ar::is_loading)
+    {
+        v = PDGNumber{value};
+    }
+}
+
+//---------------------------------------------------------------------------//
+// MATERIALS AND VOLUMES
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, ImportIsotope& v)
+{
+    ar(v.name,
+       v.atomic_number,
+       v.atomic_mass_number,
+       v.binding_energy,
+       v.proton_loss_energy,
+       v.neutron_loss_energy,
+       v.nuclear_mass);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportElement& v)
+{
+    ar(v.name, v.atomic_number, v.atomic_mass, v.isotopes_fractions);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportMatElemComponent& v)
+{
+    ar(v.element_id, v.number_fraction);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportGeoMaterial& v)
+{
+    ar(v.name, v.state, v.temperature, v.number_density, v.elements);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportProductionCut& v)
+{
+    ar(v.energy, v.range);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportPhysMaterial& v)
+{
+    ar(v.geo_material_id, v.optical_material_id, v.pdg_cutoffs);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportVolume& v)
+{
+    ar(v.geo_material_id,
+       v.region_id,
+       v.phys_material_id,
+       v.name,
+       v.solid_name);
+}
+
+//---------------------------------------------------------------------------//
+// PROCESSES AND MODELS
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, ImportPhysicsTable& v)
+{
+    ar(v.x_units, v.y_units, v.grids);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportModelMaterial& v)
+{
+    ar(v.energy, v.micro_xs);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportModel& v)
+{
+    ar(v.model_class, v.materials, v.low_energy_limit, v.high_energy_limit);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportMscModel& v)
+{
+    ar(v.particle_pdg, v.model_class, v.xs_table);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportProcess& v)
+{
+    ar(v.particle_pdg,
+       v.secondary_pdg,
+       v.process_type,
+       v.process_class,
+       v.models,
+       v.lambda,
+       v.lambda_prim,
+       v.dedx,
+       v.applies_at_rest);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportLivermoreSubshell& v)
+{
+    ar(v.binding_energy, v.param_lo, v.param_hi, v.xs);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportLivermorePE& v)
+{
+    ar(v.xs_lo, v.xs_hi, v.thresh_lo, v.thresh_hi, v.shells);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportAtomicTransition& v)
+{
+    ar(v.initial_shell, v.auger_shell, v.probability, v.energy);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportAtomicSubshell& v)
+{
+    ar(v.designator, v.fluor, v.auger);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportAtomicRelaxation& v)
+{
+    ar(v.shells);
+}
+
+//---------------------------------------------------------------------------//
+// PARAMETERS
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, ImportEmParameters& v)
+{
+    ar(v.energy_loss_fluct,
+       v.lpm,
+       v.integral_approach,
+       v.linear_loss_limit,
+       v.lowest_electron_energy,
+       v.lowest_muhad_energy,
+       v.fluorescence,
+       v.auger,
+       v.msc_step_algorithm,
+       v.msc_muhad_step_algorithm,
+       v.msc_displaced,
+       v.msc_muhad_displaced,
+       v.msc_range_factor,
+       v.msc_muhad_range_factor,
+       v.msc_safety_factor,
+       v.msc_lambda_limit,
+       v.msc_theta_limit,
+       v.apply_cuts,
+       v.screening_factor,
+       v.angle_limit_factor,
+       v.form_factor,
+       v.interpolation);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportLoopingThreshold& v)
+{
+    ar(v.threshold_trials, v.important_energy);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportTransParameters& v)
+{
+    ar(v.looping, v.max_substeps);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportOpticalProperty& v)
+{
+    ar(v.refractive_index);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportOpticalMaterial& v)
+{
+    ar(v.properties);
+}
+
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, ImportData& v)
+{
+    ar(v.isotopes,
+       v.elements,
+       v.geo_materials,
+       v.phys_materials,
+       v.volumes,
+       v.particles,
+       v.processes,
+       v.msc_models,
+       v.em_params,
+       v.trans_params,
+       v.optical_materials,
+       v.units,
+       v.livermore_photo,
+       v.mu_production,
+       v.seltzer_berger,
+       v.atomic_relaxation,
+       v.optical_physics,
+       v.mucf_physics);
+}
+
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Construct the file key for cached import data
+BinaryFileKey make_key(std::uint64_t input_hash)
+{
+    return {"ImportData", input_hash};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load imported data from a binary cache if it matches the input hash.
+ *
+ * The hash should combine every input that affects the imported data (e.g.,
+ * the geometry file contents and physics options). If the cache is missing or
+ * stale, the reason is logged and no data is returned.
+ */
+std::optional<ImportData>
+read_import_cache(std::string const& filename, std::uint64_t input_hash)
+{
+    CELER_EXPECT(!filename.empty());
+
+    ScopedProfiling profile_this{"read-import-cache"};
+
+    MappedBinaryFile cached{filename, make_key(input_hash)};
+    if (!cached)
+    {
+        CELER_LOG(info) << "Not using cached physics data at '" << filename
+                        << "': " << cached.reason();
+        return std::nullopt;
+    }
+
+    CELER_LOG(info) << "Loading cached physics data from '" << filename
+                    << "'";
+    std::optional<ImportData> result{std::in_place};
+    BinaryReader read{cached.payload()};
+    read(*result);
+    CELER_VALIDATE(read.remaining() == 0,
+                   << "cached physics data at '" << filename
+                   << "' has " << read.remaining() << " unread bytes");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save imported data to a binary cache file.
+ */
+void write_import_cache(std::string const& filename,
+                        std::uint64_t input_hash,
+                        ImportData const& data)
+{
+    CELER_EXPECT(!filename.empty());
+
+    ScopedProfiling profile_this{"write-import-cache"};
+
+    std::string payload;
+    BinaryWriter write{&payload};
+    write(data);
+    write_binary_file(filename, make_key(input_hash), payload);
+
+    CELER_LOG(info) << "Wrote " << payload.size()
+                    << " bytes of cached physics data to '" << filename
+                    << "'";
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
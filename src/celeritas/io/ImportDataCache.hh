@@ -0,0 +1,28 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportDataCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "ImportData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Load imported data from a binary cache if it matches the input hash
+std::optional<ImportData>
+read_import_cache(std::string const& filename, std::uint64_t input_hash);
+
+// Save imported data to a binary cache file
+void write_import_cache(std::string const& filename,
+                        std::uint64_t input_hash,
+                        ImportData const& data);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
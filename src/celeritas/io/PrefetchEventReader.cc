@@ -0,0 +1,133 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/PrefetchEventReader.cc
+//---------------------------------------------------------------------------//
+#include "PrefetchEventReader.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reader and the maximum number of buffered events.
+ *
+ * The background thread starts reading immediately.
+ */
+PrefetchEventReader::PrefetchEventReader(UPReader reader, size_type capacity)
+    : reader_{std::move(reader)}, capacity_{capacity}
+{
+    CELER_EXPECT(reader_);
+    CELER_VALIDATE(capacity_ > 0,
+                   << "invalid event prefetch capacity " << capacity_);
+
+    num_events_ = reader_->num_events();
+    CELER_LOG(debug) << "Prefetching up to " << capacity_ << " of "
+                     << num_events_ << " events";
+
+    thread_ = std::thread{[this] { this->read_all(); }};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop reading and wait for the background thread.
+ */
+PrefetchEventReader::~PrefetchEventReader()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    not_full_.notify_all();
+    thread_.join();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the next event, waiting for it to be read if necessary.
+ *
+ * An empty result is returned once all events have been consumed.
+ */
+auto PrefetchEventReader::operator()() -> result_type
+{
+    result_type result;
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        not_empty_.wait(lock, [this] { return !buffer_.empty() || done_; });
+        if (buffer_.empty())
+        {
+            if (error_)
+            {
+                // Rethrow the reader error to the first caller only
+                std::rethrow_exception(std::exchange(error_, nullptr));
+            }
+            return result;
+        }
+        result = std::move(buffer_.front());
+        buffer_.pop_front();
+    }
+    not_full_.notify_one();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read events into the buffer until the reader is exhausted or stopped.
+ *
+ * The next event is only read once there is space for it in the buffer, so
+ * that the buffered events plus the one being read never exceed the
+ * capacity.
+ */
+void PrefetchEventReader::read_all()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            not_full_.wait(
+                lock, [this] { return buffer_.size() < capacity_ || stop_; });
+            if (stop_)
+            {
+                return;
+            }
+        }
+
+        // Read without holding the lock: consumers can only shrink the buffer
+        result_type event;
+        std::exception_ptr error;
+        try
+        {
+            event = (*reader_)();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        if (stop_)
+        {
+            return;
+        }
+        if (error || event.empty())
+        {
+            // End of input: wake up all waiting consumers
+            error_ = std::move(error);
+            done_ = true;
+            lock.unlock();
+            not_empty_.notify_all();
+            return;
+        }
+        buffer_.push_back(std::move(event));
+        lock.unlock();
+        not_empty_.notify_one();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,92 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/PrefetchEventReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "EventIOInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read events ahead of time on a background thread.
+ *
+ * This wraps another event reader, which is called sequentially from a
+ * single background thread that fills a bounded buffer of events. Each call
+ * to \c operator() removes the oldest event from the buffer, blocking until
+ * one is available, so that at most \c capacity events are held in memory
+ * at any time. As with other readers, an empty result indicates that all
+ * events have been read.
+ *
+ * Unlike the wrapped reader, \c operator() is thread safe: multiple streams
+ * can pull events concurrently. Exceptions raised by the wrapped reader are
+ * rethrown to the caller that would have received the failed event. Reading
+ * stops at the first error, and every other call returns an empty result, so
+ * that concurrent consumers terminate normally. Callers in an OpenMP
+ * parallel region must catch the exception (e.g. with \c CELER_TRY_HANDLE)
+ * rather than let it escape the region.
+ */
+class PrefetchEventReader final : public EventReaderInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using UPReader = std::unique_ptr<EventReaderInterface>;
+    //!@}
+
+  public:
+    // Construct with a reader and the maximum number of buffered events
+    PrefetchEventReader(UPReader reader, size_type capacity);
+
+    //! Prevent copying and moving
+    CELER_DELETE_COPY_MOVE(PrefetchEventReader);
+
+    // Stop reading and wait for the background thread
+    ~PrefetchEventReader() override;
+
+    // Get the next event, waiting for it to be read if necessary
+    result_type operator()() final;
+
+    //! Get total number of events
+    size_type num_events() const final { return num_events_; }
+
+    //! Maximum number of events held in the buffer
+    size_type capacity() const { return capacity_; }
+
+  private:
+    UPReader reader_;
+    size_type num_events_;
+    size_type capacity_;
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<VecPrimary> buffer_;
+    std::exception_ptr error_;
+    bool done_{false};
+    bool stop_{false};
+
+    std::thread thread_;
+
+    //// HELPER FUNCTIONS ////
+
+    void read_all();
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -99,6 +99,9 @@ class CoreTrackView
     // Apply a tracking cut without setting the error state
     inline CELER_FUNCTION void apply_cut();
 
+    // Kill the track at the end of the step as part of variance reduction
+    inline CELER_FUNCTION void apply_roulette_kill();
+
     // Access global step counters (mutable for atomic operations)
     inline CELER_FUNCTION CoreStateCounters& counters();
     inline CELER_FUNCTION CoreStateCounters const& counters() const;
@@ -132,7 +135,8 @@ CELER_FUNCTION CoreTrackView& CoreTrackView::operator=(
     TrackInitializer const& init)
 {
     // Initialiize the sim state
-    this->sim() = SimTrackView::Initializer{init.primary, init.time};
+    this->sim()
+        = SimTrackView::Initializer{init.primary, init.time, init.weight};
 
     // Initialize the geometry state
     auto geo = this->geometry();
@@ -355,6 +359,20 @@ CELER_FUNCTION void CoreTrackView::apply_cut()
     atomic_add(&this->counters().num_cut, 1_sz);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Kill the track at the end of the step as part of variance reduction.
+ *
+ * Unlike \c apply_cut this is an expected outcome, so the track is not
+ * counted as cut, and the tracking cut action kills it without logging.
+ */
+CELER_FUNCTION void CoreTrackView::apply_roulette_kill()
+{
+    auto sim = this->sim();
+    CELER_EXPECT(is_track_valid(sim.status()));
+    sim.post_step_action(params_.scalars.tracking_cut_action);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace optical
 }  // namespace celeritas
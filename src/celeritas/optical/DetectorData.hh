@@ -18,6 +18,9 @@ namespace optical
 //---------------------------------------------------------------------------//
 /*!
  * A single hit of a photon track on a sensitive detector.
+ *
+ * The weight is the number of physical photons represented by the hit, which
+ * differs from unity only if optical biasing is enabled.
  */
 struct DetectorHit
 {
@@ -25,6 +28,7 @@ struct DetectorHit
 
     DetectorId detector{};
     PrimaryId primary{};
+    real_type weight{1};
     Energy energy;
     real_type time{};
     Real3 position{};
@@ -42,13 +42,15 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
         action_times_
             = ActionTimes::make_and_insert(inp.optical_params->action_reg(),
                                            core.aux_reg(),
-                                           "optial-action-times");
+                                           "optial-action-times",
+                                           inp.sync_stream);
     }
 
     // Create launch action with optical params+state and access to aux data
     detail::OpticalLaunchAction::Input la_inp;
     la_inp.num_track_slots = inp.num_track_slots;
     la_inp.auto_flush = inp.auto_flush;
+    la_inp.interleave_step_iters = inp.interleave_step_iters;
     la_inp.action_times = action_times_;
     la_inp.optical_params = inp.optical_params;
     launch_ = detail::OpticalLaunchAction::make_and_insert(core,
@@ -71,6 +73,7 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
         oa_inp.optical_id = launch_->aux_id();
         oa_inp.material = inp.optical_params->material();
         oa_inp.shared = inp.optical_params->cherenkov();
+        oa_inp.photon_scale = inp.photon_scale;
         cherenkov_offload_ = OffloadAction<GT::cherenkov>::make_and_insert(
             core, std::move(oa_inp));
     }
@@ -89,6 +92,7 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
         oa_inp.optical_id = launch_->aux_id();
         oa_inp.material = inp.optical_params->material();
         oa_inp.shared = inp.optical_params->scintillation();
+        oa_inp.photon_scale = inp.photon_scale;
         scint_offload_ = OffloadAction<GT::scintillation>::make_and_insert(
             core, std::move(oa_inp));
     }
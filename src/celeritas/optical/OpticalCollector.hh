@@ -89,9 +89,18 @@ class OpticalCollector
         //! Threshold number of photons for launching optical loop
         size_type auto_flush{};
 
-        //! Whether to synchronize and record accumulated action times
+        //! Optical step iterations per core step (zero to run to completion)
+        size_type interleave_step_iters{0};
+
+        //! Physical photons represented by each generated photon
+        real_type photon_scale{1};
+
+        //! Whether to record accumulated action times
         bool action_times{false};
 
+        //! Synchronize the device stream after each timed action
+        bool sync_stream{false};
+
         //! True if all input is assigned and valid
         explicit operator bool() const
         {
@@ -99,7 +108,7 @@ class OpticalCollector
                    && (optical_params->scintillation()
                        || optical_params->cherenkov())
                    && num_track_slots > 0 && buffer_capacity > 0
-                   && auto_flush > 0;
+                   && auto_flush > 0 && photon_scale >= 1;
         }
     };
 
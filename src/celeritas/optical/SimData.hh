@@ -30,10 +30,16 @@ struct SimParamsData
     size_type max_steps{};
     size_type max_step_iters{};
 
+    //! Steps between Russian roulette games (disabled if zero)
+    size_type roulette_steps{};
+    //! Probability of surviving Russian roulette
+    real_type roulette_survival{1};
+
     //! Whether the data are assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return max_steps > 0 && max_step_iters > 0;
+        return max_steps > 0 && max_step_iters > 0 && roulette_survival > 0
+               && roulette_survival <= 1;
     }
 
     //! Assign from another set of data
@@ -43,6 +49,8 @@ struct SimParamsData
         CELER_EXPECT(other);
         max_steps = other.max_steps;
         max_step_iters = other.max_step_iters;
+        roulette_steps = other.roulette_steps;
+        roulette_survival = other.roulette_survival;
         return *this;
     }
 };
@@ -67,6 +75,7 @@ struct SimStateData
     Items<TrackStatus> status;
     Items<ActionId> post_step_action;
     Items<size_type> num_steps;  //!< Total number of steps taken
+    Items<real_type> weight;  //!< Statistical weight
 
     //// METHODS ////
 
@@ -75,7 +84,7 @@ struct SimStateData
     {
         return !primary_ids.empty() && !time.empty() && !step_length.empty()
                && !status.empty() && !post_step_action.empty()
-               && !num_steps.empty();
+               && !num_steps.empty() && !weight.empty();
     }
 
     //! State size
@@ -92,6 +101,7 @@ struct SimStateData
         status = other.status;
         post_step_action = other.post_step_action;
         num_steps = other.num_steps;
+        weight = other.weight;
         return *this;
     }
 };
@@ -114,6 +124,7 @@ inline void resize(SimStateData<Ownership::value, M>* data, size_type size)
 
     resize(&data->post_step_action, size);
     resize(&data->num_steps, size);
+    resize(&data->weight, size);
 
     CELER_ENSURE(*data);
 }
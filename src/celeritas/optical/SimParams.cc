@@ -16,18 +16,28 @@ namespace optical
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with simulation options.
+ * Construct with tracking limits and optional biasing.
+ *
+ * The photon scale is applied when photons are offloaded from the main loop,
+ * so only the roulette options are used here.
  */
-SimParams::SimParams(inp::OpticalTrackingLimits const& inp)
+SimParams::SimParams(inp::OpticalTrackingLimits const& inp,
+                     inp::OpticalBiasing const& biasing)
 {
     CELER_VALIDATE(inp.steps > 0 && inp.steps <= inp::TrackingLimits::unlimited,
                    << "maximum step limit " << inp.steps
                    << " is out of range (should be in (0, "
                    << inp::TrackingLimits::unlimited << "])");
+    CELER_VALIDATE(biasing.roulette_survival > 0
+                       && biasing.roulette_survival <= 1,
+                   << "invalid roulette survival probability "
+                   << biasing.roulette_survival << " (should be in (0, 1])");
 
     HostVal<SimParamsData> host_data;
     host_data.max_steps = inp.steps;
     host_data.max_step_iters = inp.step_iters;
+    host_data.roulette_steps = biasing.roulette_steps;
+    host_data.roulette_survival = biasing.roulette_survival;
 
     data_ = ParamsDataStore<SimParamsData>{std::move(host_data)};
     CELER_ENSURE(data_);
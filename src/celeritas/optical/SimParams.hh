@@ -25,8 +25,9 @@ namespace optical
 class SimParams final : public ParamsDataInterface<SimParamsData>
 {
   public:
-    // Construct with simulation input data
-    explicit SimParams(inp::OpticalTrackingLimits const&);
+    // Construct with tracking limits and optional biasing
+    explicit SimParams(inp::OpticalTrackingLimits const&,
+                       inp::OpticalBiasing const& = {});
 
     //! Access data on host
     HostRef const& host_ref() const final { return data_.host_ref(); }
@@ -33,6 +33,7 @@ class SimTrackView
     {
         PrimaryId primary;
         real_type time{};
+        real_type weight{1};
     };
 
   public:
@@ -53,6 +54,9 @@ class SimTrackView
     // Increment the total number of steps
     inline CELER_FUNCTION void increment_num_steps();
 
+    // Set the statistical weight
+    inline CELER_FUNCTION void weight(real_type);
+
     // Reset step limiter
     inline CELER_FUNCTION void reset_step_limit();
 
@@ -79,6 +83,9 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event
     inline CELER_FUNCTION real_type time() const;
 
+    // Statistical weight
+    inline CELER_FUNCTION real_type weight() const;
+
     // Whether the track is alive or inactive or dying
     inline CELER_FUNCTION TrackStatus status() const;
 
@@ -93,6 +100,12 @@ class SimTrackView
     // Maximum number of steps before killing the track
     inline CELER_FUNCTION size_type max_steps() const;
 
+    // Number of steps between Russian roulette games (zero if disabled)
+    inline CELER_FUNCTION size_type roulette_steps() const;
+
+    // Probability of surviving Russian roulette
+    inline CELER_FUNCTION real_type roulette_survival() const;
+
   private:
     NativeCRef<SimParamsData> const& params_;
     NativeRef<SimStateData> const& states_;
@@ -127,6 +140,7 @@ CELER_FUNCTION SimTrackView& SimTrackView::operator=(Initializer const& init)
     states_.status[track_slot_] = TrackStatus::initializing;
     states_.post_step_action[track_slot_] = {};
     states_.num_steps[track_slot_] = 0;
+    states_.weight[track_slot_] = init.weight;
     return *this;
 }
 
@@ -149,6 +163,16 @@ CELER_FORCEINLINE_FUNCTION void SimTrackView::increment_num_steps()
     ++states_.num_steps[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Set the statistical weight.
+ */
+CELER_FUNCTION void SimTrackView::weight(real_type weight)
+{
+    CELER_EXPECT(weight > 0);
+    states_.weight[track_slot_] = weight;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Add the time change over the step.
@@ -260,6 +284,15 @@ CELER_FORCEINLINE_FUNCTION real_type SimTrackView::time() const
     return states_.time[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Statistical weight.
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::weight() const
+{
+    return states_.weight[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
@@ -296,6 +329,24 @@ CELER_FORCEINLINE_FUNCTION size_type SimTrackView::max_steps() const
     return params_.max_steps;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Number of steps between Russian roulette games (zero if disabled).
+ */
+CELER_FORCEINLINE_FUNCTION size_type SimTrackView::roulette_steps() const
+{
+    return params_.roulette_steps;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Probability of surviving Russian roulette.
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::roulette_survival() const
+{
+    return params_.roulette_survival;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace optical
 }  // namespace celeritas
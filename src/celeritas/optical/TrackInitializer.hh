@@ -47,6 +47,8 @@ struct TrackInitializer
     PrimaryId primary;
     //! Starting volume
     ImplVolumeId volume{};
+    //! Statistical weight
+    real_type weight{1};
 };
 
 //---------------------------------------------------------------------------//
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "corecel/io/Logger.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "celeritas/phys/GeneratorRegistry.hh"  // IWYU pragma: keep
@@ -34,27 +35,43 @@ Transporter::Transporter(Input&& inp) : input_(std::move(inp))
 
 //---------------------------------------------------------------------------//
 /*!
- * Transport all pending optical tracks on the host.
+ * Transport all pending optical tracks.
  */
 void Transporter::operator()(CoreStateBase& state) const
 {
+    return (*this)(state, numeric_limits<size_type>::max());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport optical tracks for at most the given step iterations.
+ *
+ * The loop ends early if all tracks are completed. The flush counter is only
+ * incremented when no tracks remain.
+ */
+void Transporter::operator()(CoreStateBase& state,
+                             size_type max_step_iters) const
+{
+    CELER_EXPECT(max_step_iters > 0);
+
     if (auto* s = dynamic_cast<CoreStateHost*>(&state))
     {
-        return this->transport_impl(*s);
+        return this->transport_impl(*s, max_step_iters);
     }
     else if (auto* s = dynamic_cast<CoreStateDevice*>(&state))
     {
-        return this->transport_impl(*s);
+        return this->transport_impl(*s, max_step_iters);
     }
     CELER_ASSERT_UNREACHABLE();
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Transport all pending optical tracks.
+ * Transport optical tracks for up to the given number of step iterations.
  */
 template<MemSpace M>
-void Transporter::transport_impl(CoreState<M>& state) const
+void Transporter::transport_impl(CoreState<M>& state,
+                                 size_type max_step_iters) const
 {
     CELER_EXPECT(state.aux());
 
@@ -62,42 +79,53 @@ void Transporter::transport_impl(CoreState<M>& state) const
 
     size_type num_step_iters{0};
     size_type num_steps{0};
+    size_type num_tail_iters{0};
+    bool aborted{false};
 
     auto counters = state.sync_get_counters();
 
     // Store a pointer to aux data for timing results
-    std::vector<double>* accum_time = nullptr;
+    ActionTimesState* action_times = nullptr;
     if (input_.action_times)
     {
-        accum_time = &input_.action_times->state(*state.aux()).accum_time;
+        action_times = &input_.action_times->state(*state.aux());
     }
 
     // Loop while photons are yet to be tracked
-    while (counters.num_pending > 0 || counters.num_alive > 0)
+    while ((counters.num_pending > 0 || counters.num_alive > 0)
+           && num_step_iters < max_step_iters)
     {
         ScopedProfiling profile_this{"step"};
         Stopwatch get_step_time;
 
         // Loop through actions
+        if (action_times)
+        {
+            action_times->mark();
+        }
         for (auto const& action : actions_->step())
         {
             ScopedProfiling profile_this{action->label()};
-            Stopwatch get_action_time;
             action->step(*this->params(), state);
-            if (accum_time)
+            if (action_times)
             {
-                if (M == MemSpace::device)
-                {
-                    device().stream(state.stream_id()).sync();
-                }
-                (*accum_time)[action->action_id().get()] += get_action_time();
+                action_times->record(action->action_id());
             }
         }
+        if (action_times)
+        {
+            action_times->end_step();
+        }
 
         // No longer have a reference to the counters, so need to retrieve the
         // updated values
         counters = state.sync_get_counters();
         num_steps += counters.num_active;
+        if (counters.num_pending == 0)
+        {
+            // No more tracks to fill vacancies
+            ++num_tail_iters;
+        }
 
         // Record the step time
         if (input_.step_times)
@@ -128,6 +156,7 @@ void Transporter::transport_impl(CoreState<M>& state) const
 
             this->params()->gen_reg()->reset(*state.aux());
             state.reset();
+            aborted = true;
             break;
         }
     }
@@ -145,11 +174,23 @@ void Transporter::transport_impl(CoreState<M>& state) const
     // Update statistics
     state.accum().steps += num_steps;
     state.accum().step_iters += num_step_iters;
-    ++state.accum().flushes;
+    state.accum().slot_iters += num_step_iters * state.size();
+    state.accum().tail_step_iters += num_tail_iters;
+    if (aborted || (counters.num_pending == 0 && counters.num_alive == 0))
+    {
+        ++state.accum().flushes;
+    }
 
     // Accumulate cut/error counters from the last synchronized counters
     state.accum().num_cut += counters.num_cut;
     state.accum().num_errored += counters.num_errored;
+    if (!aborted && (counters.num_cut > 0 || counters.num_errored > 0))
+    {
+        // Clear them so that later launches don't count them again
+        counters.num_cut = 0;
+        counters.num_errored = 0;
+        state.sync_put_counters(counters);
+    }
 }
 
 //---------------------------------------------------------------------------//
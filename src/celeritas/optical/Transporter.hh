@@ -32,6 +32,10 @@ class CoreStateBase;
 /*!
  * Transport all pending optical tracks to completion.
  *
+ * Tracks can also be transported for a limited number of step iterations,
+ * leaving any remaining tracks alive (and pending tracks queued) in the state
+ * to be continued later.
+ *
  * \note This class must be constructed \em after all optical actions have been
  * added to the action registry.
  */
@@ -63,6 +67,9 @@ class Transporter
     // Transport all pending optical tracks
     void operator()(CoreStateBase&) const;
 
+    // Transport optical tracks for at most the given step iterations
+    void operator()(CoreStateBase&, size_type max_step_iters) const;
+
     //! Access the shared params
     SPConstParams const& params() const { return input_.params; }
 
@@ -86,7 +93,7 @@ class Transporter
     //// HELPERS ////
 
     template<MemSpace M>
-    void transport_impl(CoreState<M>&) const;
+    void transport_impl(CoreState<M>&, size_type max_step_iters) const;
 };
 
 //---------------------------------------------------------------------------//
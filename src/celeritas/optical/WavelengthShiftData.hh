@@ -31,6 +31,7 @@ struct WlsDistributionData
     real_type time{};  //!< Post-step time
     Real3 position{};
     PrimaryId primary;  //!< For correlating to G4 tracks
+    real_type weight{1};  //!< Statistical weight of each photon
     OptMatId material;
 
     //! Check whether the data are assigned
@@ -15,6 +15,9 @@ namespace optical
 //---------------------------------------------------------------------------//
 /*!
  * Kill misbehaving photons and deposit energy locally.
+ *
+ * This also kills photons that reach the step limit or lose a game of Russian
+ * roulette.
  */
 class TrackingCutAction final : public OpticalStepActionInterface,
                                 public StaticConcreteAction
@@ -13,6 +13,8 @@
 #include "celeritas/optical/SimTrackView.hh"
 #include "celeritas/optical/detail/GroupVelocityCalculator.hh"
 
+#include "RussianRoulette.hh"
+
 namespace celeritas
 {
 namespace optical
@@ -26,6 +28,7 @@ namespace detail
  * - Calculate the group velocity in the material
  * - Update track time based on step length and group velocity
  * - Update number of steps
+ * - Play Russian roulette if enabled
  * - Update remaining MFPs to interaction
  */
 struct AlongStepExecutor
@@ -61,6 +64,19 @@ CELER_FUNCTION void AlongStepExecutor::operator()(CoreTrackView& track)
         return;
     }
 
+    // Play Russian roulette, preserving the expected weight of survivors
+    if (size_type n = sim.roulette_steps(); n > 0 && sim.num_steps() % n == 0)
+    {
+        real_type weight = sim.weight();
+        auto rng = track.rng();
+        if (!RussianRoulette{sim.roulette_survival()}(rng, &weight))
+        {
+            track.apply_roulette_kill();
+            return;
+        }
+        sim.weight(weight);
+    }
+
     // Update remaining MFPs to interaction
     auto phys = track.physics();
     if (sim.post_step_action() != phys.discrete_action())
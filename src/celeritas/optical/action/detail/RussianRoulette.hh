@@ -0,0 +1,76 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/detail/RussianRoulette.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/random/distribution/BernoulliDistribution.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Play Russian roulette with a photon's statistical weight.
+ *
+ * The photon survives with probability \em p, and a survivor's weight is
+ * divided by \em p so that the expected weight is unchanged. The result is
+ * false if the photon should be killed, in which case the weight is not
+ * modified.
+ */
+class RussianRoulette
+{
+  public:
+    // Construct with the survival probability
+    explicit inline CELER_FUNCTION RussianRoulette(real_type survival);
+
+    // Play a game, updating the weight of a survivor
+    template<class Engine>
+    inline CELER_FUNCTION bool operator()(Engine& rng, real_type* weight) const;
+
+  private:
+    real_type survival_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the survival probability.
+ */
+CELER_FUNCTION RussianRoulette::RussianRoulette(real_type survival)
+    : survival_{survival}
+{
+    CELER_EXPECT(survival_ > 0 && survival_ <= 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Play a game, updating the weight of a survivor.
+ */
+template<class Engine>
+CELER_FUNCTION bool
+RussianRoulette::operator()(Engine& rng, real_type* weight) const
+{
+    CELER_EXPECT(weight && *weight > 0);
+
+    if (!BernoulliDistribution{survival_}(rng))
+    {
+        return false;
+    }
+    *weight /= survival_;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace optical
+}  // namespace celeritas
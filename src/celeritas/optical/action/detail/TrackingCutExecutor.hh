@@ -21,7 +21,11 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Kill a malfunctioning photon.
+ * Kill a photon at the end of its step.
+ *
+ * This applies to malfunctioning photons, photons that reach the step limit,
+ * and photons killed by Russian roulette. Only errored photons are logged,
+ * since the other outcomes are expected (and roulette kills are frequent).
  */
 struct TrackingCutExecutor
 {
@@ -31,23 +35,17 @@ struct TrackingCutExecutor
 //---------------------------------------------------------------------------//
 CELER_FUNCTION void TrackingCutExecutor::operator()(CoreTrackView& track)
 {
-    auto deposited = track.particle().energy().value();
-
     auto&& sim = track.sim();
 #if !CELER_DEVICE_COMPILE
+    if (sim.status() == TrackStatus::errored)
     {
         using Energy = ParticleTrackView::Energy;
-        // Print a debug message if track is just being cut; error message if
-        // an error occurred
-        auto msg = self_logger()(CELER_CODE_PROVENANCE,
-                                 sim.status() == TrackStatus::errored
-                                     ? LogLevel::error
-                                     : LogLevel::debug);
-        msg << "Killing optical photon: lost " << deposited << ' '
+        // Print an error message if an error occurred
+        auto msg = self_logger()(CELER_CODE_PROVENANCE, LogLevel::error);
+        msg << "Killing optical photon: lost "
+            << track.particle().energy().value() << ' '
             << Energy::unit_type::label();
     }
-#else
-    CELER_DISCARD(deposited);
 #endif
 
     sim.status(TrackStatus::killed);
@@ -132,16 +132,31 @@ void OpticalLaunchAction::execute_impl(CoreParams const&,
     auto const core_counters = core_state.sync_get_counters();
     auto const counters = state.sync_get_counters();
 
-    if ((counters.num_pending < data_.auto_flush
-         && (core_counters.num_alive > 0 || core_counters.num_initializers > 0))
-        || counters.num_pending == 0)
+    if (counters.num_pending == 0 && counters.num_alive == 0)
     {
-        // Don't launch the optical loop if the number of pending tracks is
-        // below the threshold and the core stepping loop hasn't completed yet
+        // No optical tracks to transport
         return;
     }
 
-    // Transport pending optical tracks
+    if (core_counters.num_alive > 0 || core_counters.num_initializers > 0)
+    {
+        if (data_.interleave_step_iters > 0
+            && (counters.num_alive > 0
+                || counters.num_pending >= data_.auto_flush))
+        {
+            // Take a limited number of optical steps alongside the core loop
+            (*transport_)(state, data_.interleave_step_iters);
+            return;
+        }
+        if (counters.num_pending < data_.auto_flush)
+        {
+            // Wait until the number of pending tracks reaches the threshold
+            // or the core stepping loop completes
+            return;
+        }
+    }
+
+    // Transport pending optical tracks to completion
     (*transport_)(state);
 }
 
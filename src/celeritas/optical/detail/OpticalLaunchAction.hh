@@ -39,6 +39,13 @@ namespace detail
  *
  * This stores the optical tracking loop's core params, initializing them at
  * the beginning of the run, and stores the optical core state as "aux" data.
+ *
+ * The optical loop is launched once the number of pending photons reaches the
+ * \c auto_flush threshold, or when the core loop has run out of tracks. By
+ * default it then transports all pending photons to completion. If \c
+ * interleave_step_iters is nonzero, it instead takes at most that many optical
+ * step iterations per core step while the core loop is still active, keeping
+ * both the core and optical states occupied.
  */
 class OpticalLaunchAction : public AuxParamsInterface,
                             public CoreStepActionInterface,
@@ -56,6 +63,7 @@ class OpticalLaunchAction : public AuxParamsInterface,
         SPOpticalParams optical_params;
         size_type num_track_slots{};
         size_type auto_flush{};
+        size_type interleave_step_iters{0};
         SPActionTimes action_times;
 
         //! True if all input is assigned and valid
@@ -200,6 +200,7 @@ CELER_FUNCTION TrackInitializer CherenkovGenerator::operator()(Generator& rng)
     photon.position = dist_.points[StepPoint::pre].pos;
     axpy(u, delta_pos_, &photon.position);
     photon.primary = dist_.primary;
+    photon.weight = dist_.weight;
     return photon;
 }
 
@@ -22,6 +22,7 @@
 
 #include "detail/GeneratorAlgorithms.hh"
 #include "detail/GeneratorExecutor.hh"
+#include "detail/OffloadAlgorithms.hh"
 #include "detail/UpdateSumExecutor.hh"
 
 namespace celeritas
@@ -195,17 +196,37 @@ void GeneratorAction::step_impl(CoreParams const& params,
     auto& aux_state = get<GeneratorState<M>>(*state.aux(), this->aux_id());
     auto& counters = aux_state.counters;
 
-    if (counters.num_generated == 0 && counters.buffer_size > 0)
+    if (counters.num_pending == 0)
+    {
+        // Buffer is new, or its counters were reset
+        aux_state.num_scanned = 0;
+    }
+    if (counters.buffer_size > aux_state.num_scanned)
     {
-        // If this process created photons, on the first step iteration
-        // calculate the cumulative sum of the number of photons in the
-        // buffered distributions. These values are used to determine which
-        // thread will generate photons from which distribution
+        aux_state.accum.buffer_size += counters.buffer_size
+                                       - aux_state.num_scanned;
+        if (aux_state.num_scanned > 0)
+        {
+            // New distributions were added (e.g., by the core loop when the
+            // optical loop is interleaved) while others are partially
+            // generated: remove the fully generated ones
+            counters.buffer_size = ::celeritas::detail::remove_if_invalid(
+                aux_state.store.ref().distributions,
+                0,
+                counters.buffer_size,
+                state.stream_id());
+        }
+
+        // If this process created photons, calculate the cumulative sum of
+        // the number of photons in the buffered distributions. These values
+        // are used to determine which thread will generate photons from which
+        // distribution
         counters.num_pending = detail::inclusive_scan_photons(
             aux_state.store.ref().distributions,
             aux_state.store.ref().offsets,
             counters.buffer_size,
             state.stream_id());
+        aux_state.num_scanned = counters.buffer_size;
     }
 
     if (state.sync_get_counters().num_vacancies > 0 && counters.num_pending > 0)
@@ -221,7 +242,6 @@ void GeneratorAction::step_impl(CoreParams const& params,
     // number of photons generated
     if (counters.num_pending == 0)
     {
-        aux_state.accum.buffer_size += counters.buffer_size;
         counters = {};
     }
 }
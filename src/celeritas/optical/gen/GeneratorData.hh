@@ -60,6 +60,7 @@ struct GeneratorDistributionData
     GeneratorType type{GeneratorType::size_};  //!< Cherenkov or scintillation
     size_type num_photons{};  //!< Sampled number of photons to generate
     PrimaryId primary;  //!< For correlating to G4 tracks
+    real_type weight{1};  //!< Statistical weight of each photon
     real_type step_length{};
     units::ElementaryCharge charge;
     OptMatId material;
@@ -161,6 +162,9 @@ struct GeneratorState : public GeneratorStateBase
 {
     StateDataStore<GeneratorStateData, M> store;
 
+    //! Number of buffered distributions included in the photon offsets
+    size_type num_scanned{0};
+
     //! Access valid range of distributions
     auto distributions()
     {
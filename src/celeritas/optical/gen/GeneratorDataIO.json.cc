@@ -41,6 +41,7 @@ void to_json(nlohmann::json& j, GeneratorDistributionData const& v)
         CELER_JSON_PAIR(v, type),
         CELER_JSON_PAIR(v, num_photons),
         CELER_JSON_PAIR(v, primary),
+        CELER_JSON_PAIR(v, weight),
         CELER_JSON_PAIR(v, step_length),
         CELER_JSON_PAIR(v, charge),
         CELER_JSON_PAIR(v, material),
@@ -58,6 +59,7 @@ void from_json(nlohmann::json const& j, GeneratorDistributionData& v)
     CELER_JSON_LOAD_REQUIRED(j, v, type);
     CELER_JSON_LOAD_REQUIRED(j, v, num_photons);
     CELER_JSON_LOAD_REQUIRED(j, v, primary);
+    CELER_JSON_LOAD_OPTION(j, v, weight);
     CELER_JSON_LOAD_REQUIRED(j, v, step_length);
     CELER_JSON_LOAD_REQUIRED(j, v, charge);
     CELER_JSON_LOAD_REQUIRED(j, v, material);
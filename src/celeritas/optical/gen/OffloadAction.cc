@@ -164,7 +164,8 @@ void OffloadAction<G>::offload(CoreParams const& core_params,
                  (G == GeneratorType::scintillation)
                      ? this->get_post_step_data(core_state)
                      : NativeRef<PostTraitsT::template Data>{},
-                 gen_state.counters.buffer_size}};
+                 gen_state.counters.buffer_size,
+                 data_.photon_scale}};
     launch_action(*this, core_params, core_state, execute);
 }
 
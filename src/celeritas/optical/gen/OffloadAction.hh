@@ -49,10 +49,13 @@ class OffloadAction final : public CoreStepActionInterface
         AuxId optical_id;
         SPConstMaterial material;
         SPConstParams shared;
+        //! Physical photons represented by each generated photon
+        real_type photon_scale{1};
 
         explicit operator bool() const
         {
-            return pre_step_id && gen_id && optical_id && material && shared;
+            return pre_step_id && gen_id && optical_id && material && shared
+                   && photon_scale >= 1;
         }
     };
 
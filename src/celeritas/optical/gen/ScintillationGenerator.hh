@@ -208,6 +208,7 @@ CELER_FUNCTION TrackInitializer ScintillationGenerator::operator()(
     }
 
     photon.primary = dist_.primary;
+    photon.weight = dist_.weight;
 
     return photon;
 }
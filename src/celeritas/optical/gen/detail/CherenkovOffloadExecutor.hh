@@ -12,6 +12,7 @@
 
 #include "../CherenkovOffload.hh"
 #include "../OffloadData.hh"
+#include "PhotonScaler.hh"
 
 namespace celeritas
 {
@@ -34,6 +35,7 @@ struct CherenkovOffloadExecutor
     NativeRef<OffloadPreStateData> const pre_steps;
     NativeRef<OffloadPrePostStateData> const pre_post_steps;  //!< Unused
     size_type buffer_size;
+    real_type photon_scale;  //!< Physical photons per generated photon
 };
 
 //---------------------------------------------------------------------------//
@@ -85,6 +87,7 @@ CELER_FUNCTION void CherenkovOffloadExecutor::operator()(
             cherenkov);
         auto rng = track.rng();
         dist = sample_dist(rng);
+        PhotonScaler{photon_scale}(rng, &dist);
     }
 }
 
@@ -9,6 +9,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/optical/WavelengthShiftData.hh"
+#include "celeritas/track/detail/BlockedAlgorithms.hh"
 
 #include "../GeneratorData.hh"
 
@@ -22,6 +23,11 @@ namespace detail
 /*!
  * Calculate the inclusive prefix sum of the number of optical photons.
  *
+ * The offsets are used to expand the distributions into track slots: a
+ * distribution with many photons is spread over as many slots (and steps) as
+ * needed. With track-level OpenMP and a large buffer, the scan is split
+ * across host threads.
+ *
  * \return Total accumulated value
  */
 template<class T>
@@ -37,6 +43,11 @@ size_type inclusive_scan_photons(
 
     auto* data = buffer.data().get();
     auto* result = offsets.data().get();
+    if (::celeritas::detail::use_blocked(size))
+    {
+        return ::celeritas::detail::blocked_transform_inclusive_scan(
+            data, result, size, GetNumPhotons<T>{});
+    }
 
     size_type acc = 0;
     auto* const stop = data + size;
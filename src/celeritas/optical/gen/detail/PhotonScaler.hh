@@ -0,0 +1,91 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/gen/detail/PhotonScaler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/random/distribution/BernoulliDistribution.hh"
+#include "celeritas/optical/gen/GeneratorData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Reduce the number of photons in a distribution by a constant scale.
+ *
+ * Each remaining photon represents \c scale physical photons. The scaled
+ * number of photons is rounded up or down at random so that the expected
+ * total weight of the distribution is unchanged.
+ */
+class PhotonScaler
+{
+  public:
+    // Construct with the number of physical photons per generated photon
+    explicit inline CELER_FUNCTION PhotonScaler(real_type scale);
+
+    // Scale a sampled distribution
+    template<class Engine>
+    inline CELER_FUNCTION void
+    operator()(Engine& rng, optical::GeneratorDistributionData* dist) const;
+
+  private:
+    real_type scale_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of physical photons per generated photon.
+ */
+CELER_FUNCTION PhotonScaler::PhotonScaler(real_type scale) : scale_{scale}
+{
+    CELER_EXPECT(scale_ >= 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Scale a sampled distribution.
+ */
+template<class Engine>
+CELER_FUNCTION void
+PhotonScaler::operator()(Engine& rng,
+                         optical::GeneratorDistributionData* dist) const
+{
+    CELER_EXPECT(dist);
+
+    if (scale_ == 1 || dist->num_photons == 0)
+    {
+        return;
+    }
+
+    real_type scaled = dist->num_photons / scale_;
+    real_type lower = std::floor(scaled);
+    size_type num_photons = static_cast<size_type>(lower);
+    if (BernoulliDistribution{scaled - lower}(rng))
+    {
+        ++num_photons;
+    }
+
+    if (num_photons == 0)
+    {
+        // No photons survived: clear the distribution
+        *dist = {};
+        return;
+    }
+    dist->num_photons = num_photons;
+    dist->weight *= scale_;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -13,6 +13,8 @@
 #include "celeritas/optical/gen/OffloadData.hh"
 #include "celeritas/optical/gen/ScintillationOffload.hh"
 
+#include "PhotonScaler.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -38,6 +40,7 @@ struct ScintOffloadExecutor
     NativeRef<OffloadPreStateData> const pre_steps;
     NativeRef<OffloadPrePostStateData> const pre_post_steps;
     size_type buffer_size;
+    real_type photon_scale;  //!< Physical photons per generated photon
 };
 
 //---------------------------------------------------------------------------//
@@ -85,6 +88,7 @@ CELER_FUNCTION void ScintOffloadExecutor::operator()(CoreTrackView const& track)
     // Get the distribution data used to generate scintillation optical photons
     dist = ScintillationOffload(
         particle, sim, pos, edep, scint, pre_step, pre_post_step)(rng);
+    PhotonScaler{photon_scale}(rng, &dist);
 }
 
 //---------------------------------------------------------------------------//
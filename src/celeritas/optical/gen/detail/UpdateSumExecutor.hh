@@ -22,6 +22,10 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Subtract the number of tracks generated in the step from the cumulative sum.
+ *
+ * The number of photons in each distribution is updated to the number left
+ * to generate, so that fully generated distributions are invalid and can be
+ * removed from the buffer.
  */
 struct UpdateSumExecutor
 {
@@ -52,15 +56,19 @@ CELER_FUNCTION void UpdateSumExecutor::operator()(TrackSlotId tid) const
     CELER_EXPECT(num_gen > 0);
     CELER_EXPECT(tid < offload.offsets.size());
 
+    auto subtract_gen = [this](size_type value) {
+        return value < num_gen ? 0 : value - num_gen;
+    };
+
     auto& offset = offload.offsets[ItemId<size_type>(tid.get())];
-    if (offset < num_gen)
-    {
-        offset = 0;
-    }
-    else
-    {
-        offset -= num_gen;
-    }
+    auto& dist
+        = offload.distributions[ItemId<GeneratorDistributionData>(tid.get())];
+    CELER_ASSERT(dist.num_photons <= offset);
+
+    // Cumulative sum of the previous distribution
+    size_type prev_offset = subtract_gen(offset - dist.num_photons);
+    offset = subtract_gen(offset);
+    dist.num_photons = offset - prev_offset;
 }
 
 //---------------------------------------------------------------------------//
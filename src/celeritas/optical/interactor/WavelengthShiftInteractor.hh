@@ -91,6 +91,7 @@ CELER_FUNCTION WavelengthShiftInteractor::WavelengthShiftInteractor(
     distribution_.time = sim.time();
     distribution_.position = pos;
     distribution_.primary = sim.primary_id();
+    distribution_.weight = sim.weight();
     distribution_.material = mat_id;
 }
 
@@ -0,0 +1,63 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/EventQueue.cc
+//---------------------------------------------------------------------------//
+#include "EventQueue.hh"
+
+#include <algorithm>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the events to process.
+ */
+EventQueue::EventQueue(SpanConstEvent events, bool largest_first)
+    : order_(events.size())
+{
+    for (auto i : range(events.size()))
+    {
+        order_[i] = id_cast<EventId>(i);
+    }
+    if (largest_first)
+    {
+        // Estimate the cost of each event from its total primary energy
+        std::vector<real_type> energy(events.size(), 0);
+        for (auto i : range(events.size()))
+        {
+            for (Primary const& p : events[i])
+            {
+                energy[i] += p.energy.value();
+            }
+        }
+        std::stable_sort(order_.begin(),
+                         order_.end(),
+                         [&energy](EventId left, EventId right) {
+                             return energy[left.get()] > energy[right.get()];
+                         });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Claim the next event, or a null ID if none remain.
+ *
+ * This is thread safe and may be called concurrently from all streams.
+ */
+EventId EventQueue::operator()()
+{
+    size_type idx = next_.fetch_add(1, std::memory_order_relaxed);
+    if (idx >= order_.size())
+    {
+        return {};
+    }
+    return order_[idx];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
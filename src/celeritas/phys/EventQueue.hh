@@ -0,0 +1,64 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/EventQueue.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/Types.hh"
+
+#include "Primary.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Hand out preloaded events to concurrent streams.
+ *
+ * Each call claims the next unprocessed event from a shared lock-free
+ * counter, so that streams finishing early pick up the remaining work rather
+ * than idling. Every event is returned exactly once, and a null ID is
+ * returned once all events have been claimed.
+ *
+ * Events are handed out in input order unless \c largest_first is set, in
+ * which case events with the highest total primary energy (the best
+ * available estimate of their cost) are handed out first to reduce the tail
+ * of the run. Events with equal energy keep their input order.
+ */
+class EventQueue
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecPrimary = std::vector<Primary>;
+    using SpanConstEvent = Span<VecPrimary const>;
+    //!@}
+
+  public:
+    // Construct from the events to process
+    EventQueue(SpanConstEvent events, bool largest_first);
+
+    //! Prevent copying and moving
+    CELER_DELETE_COPY_MOVE(EventQueue);
+    ~EventQueue() = default;
+
+    // Claim the next event, or a null ID if none remain
+    EventId operator()();
+
+    //! Total number of events
+    size_type size() const { return order_.size(); }
+
+  private:
+    std::vector<EventId> order_;
+    std::atomic<size_type> next_{0};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -42,6 +42,12 @@ struct GeneratorCounters
 //---------------------------------------------------------------------------//
 /*!
  * Cumulative statistics of tracking.
+ *
+ * The ratio of \c steps to \c slot_iters is the average fraction of track
+ * slots that were active during a step iteration. Vacant slots can only be
+ * refilled while tracks are pending, so a large number of "tail" step
+ * iterations (after all pending tracks have been generated) indicates that the
+ * state is draining.
  */
 struct CounterAccumStats
 {
@@ -53,6 +59,8 @@ struct CounterAccumStats
     size_type steps{0};
     size_type step_iters{0};
     size_type flushes{0};
+    size_type slot_iters{0};  //!< Track slots summed over step iterations
+    size_type tail_step_iters{0};  //!< Step iterations with none pending
     size_type num_cut{0};  //!< Tracks killed by tracking cuts
     size_type num_errored{0};  //!< Tracks killed due to errors
 };
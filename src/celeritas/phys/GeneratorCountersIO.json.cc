@@ -19,6 +19,8 @@ void to_json(nlohmann::json& j, CounterAccumStats const& v)
         CELER_JSON_PAIR(v, steps),
         CELER_JSON_PAIR(v, step_iters),
         CELER_JSON_PAIR(v, flushes),
+        CELER_JSON_PAIR(v, slot_iters),
+        CELER_JSON_PAIR(v, tail_step_iters),
         CELER_JSON_PAIR(v, num_cut),
         CELER_JSON_PAIR(v, num_errored),
     };
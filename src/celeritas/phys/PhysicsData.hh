@@ -7,6 +7,7 @@
 #pragma once
 
 #include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/StackAllocatorData.hh"
 #include "celeritas/Quantities.hh"
@@ -268,6 +269,7 @@ struct PhysicsParamsScalars
 
     real_type secondary_stack_factor = 3;  //!< Secondary storage per state
                                            //!< size
+    bool count_xs_cache{false};  //!< Diagnostic cross section cache counters
     // When fixed step limiter is used, this is the corresponding action ID
     ActionId fixed_step_action{};
 
@@ -408,6 +410,7 @@ struct PhysicsParamsData
  *
  * State that's persistent across steps:
  * - Remaining number of mean free paths to the next discrete interaction
+ * - Particle, material, and energy of the cached per-process cross sections
  *
  * State that is reset at every step:
  * - Current macroscopic cross section
@@ -420,6 +423,11 @@ struct PhysicsTrackState
 {
     real_type interaction_mfp;  //!< Remaining MFP to interaction
 
+    // CROSS SECTION CACHE KEY
+    ParticleId xs_particle;  //!< Particle type of the cached cross sections
+    PhysMatId xs_material;  //!< Material of the cached cross sections
+    real_type xs_energy;  //!< Energy [MeV] of the cached cross sections
+
     // TEMPORARY STATE
     real_type macro_xs;  //!< Total cross section for discrete interactions
     real_type energy_deposition;  //!< Local energy deposition in a step [MeV]
@@ -465,6 +473,8 @@ struct PhysicsStateData
     StateItems<MscStep> msc_step;  //!< Internal MSC data [track]
 
     Items<real_type> per_process_xs;  //!< XS [track][particle process]
+    StateItems<size_type> xs_cache_hits;  //!< Reused xs [track] (optional)
+    StateItems<size_type> xs_cache_misses;  //!< Recalculated xs [track]
 
     AtomicRelaxStateData<W, M> relaxation;  //!< Scratch data
     StackAllocatorData<Secondary, W, M> secondaries;  //!< Secondary stack
@@ -489,6 +499,8 @@ struct PhysicsStateData
         msc_step = other.msc_step;
 
         per_process_xs = other.per_process_xs;
+        xs_cache_hits = other.xs_cache_hits;
+        xs_cache_misses = other.xs_cache_misses;
 
         relaxation = other.relaxation;
         secondaries = other.secondaries;
@@ -512,6 +524,13 @@ inline void resize(PhysicsStateData<Ownership::value, M>* state,
     resize(&state->msc_step, size);
     resize(&state->per_process_xs,
            size * params.scalars.max_particle_processes);
+    if (params.scalars.count_xs_cache)
+    {
+        resize(&state->xs_cache_hits, size);
+        fill(size_type{0}, &state->xs_cache_hits);
+        resize(&state->xs_cache_misses, size);
+        fill(size_type{0}, &state->xs_cache_misses);
+    }
     resize(&state->relaxation, params.hardwired.relaxation, size);
     resize(
         &state->secondaries,
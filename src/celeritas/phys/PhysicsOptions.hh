@@ -114,6 +114,9 @@ struct ParticleOptions
  *   processes use MC integration to sample the discrete interaction length
  *   with the correct probability. Disable this integral approach for all
  *   processes.
+ * - \c count_xs_cache: count the steps that reuse or recalculate the
+ *   previous step's cross sections. This is a diagnostic that adds a write to
+ *   track state memory on every step.
  */
 struct PhysicsOptions
 {
@@ -142,6 +145,7 @@ struct PhysicsOptions
 
     real_type secondary_stack_factor{3};
     bool disable_integral_xs{false};
+    bool count_xs_cache{false};
 };
 
 //---------------------------------------------------------------------------//
@@ -195,6 +195,31 @@ auto PhysicsParams::processes(ParticleId id) const -> SpanConstProcessId
         data.process_ids[data.process_groups[id].processes]);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Add cross section cache counts from a track state.
+ *
+ * This is called by the core state when it is destroyed, and it is thread
+ * safe.
+ */
+void PhysicsParams::add_xs_cache_counts(XsCacheCounts const& counts) const
+{
+    xs_cache_hits_.fetch_add(counts.hits, std::memory_order_relaxed);
+    xs_cache_misses_.fetch_add(counts.misses, std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get cross section cache counts accumulated over destroyed states.
+ */
+XsCacheCounts PhysicsParams::xs_cache_counts() const
+{
+    XsCacheCounts result;
+    result.hits = xs_cache_hits_.load(std::memory_order_relaxed);
+    result.misses = xs_cache_misses_.load(std::memory_order_relaxed);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -286,6 +311,7 @@ void PhysicsParams::build_options(Options const& opts, HostValue* data) const
     data->scalars.secondary_stack_factor = opts.secondary_stack_factor;
     data->scalars.lambda_limit = opts.lambda_limit;
     data->scalars.safety_factor = opts.safety_factor;
+    data->scalars.count_xs_cache = opts.count_xs_cache;
 
     this->build_particle_options(opts.light, &data->scalars.light);
     this->build_particle_options(opts.heavy, &data->scalars.heavy);
@@ -6,6 +6,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -31,6 +33,16 @@ class AtomicRelaxationParams;
 class MaterialParams;
 class ParticleParams;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Number of step cross section calculations reused from the previous step.
+ */
+struct XsCacheCounts
+{
+    std::size_t hits{0};  //!< Cross sections reused
+    std::size_t misses{0};  //!< Cross sections recalculated
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Manage physics processes and models.
@@ -120,6 +132,14 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     //! Access physics properties on the device
     DeviceRef const& device_ref() const final { return device_ref_; }
 
+    //// DIAGNOSTICS ////
+
+    // Add cross section cache counts from a track state
+    void add_xs_cache_counts(XsCacheCounts const&) const;
+
+    // Get cross section cache counts accumulated over destroyed states
+    XsCacheCounts xs_cache_counts() const;
+
   private:
     using BC = SplineDerivCalculator::BoundaryCondition;
     using SPAction = std::shared_ptr<StaticConcreteAction>;
@@ -147,6 +167,10 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     DeviceValue device_;
     DeviceRef device_ref_;
 
+    // Cross section cache counters accumulated from states
+    mutable std::atomic<std::size_t> xs_cache_hits_{0};
+    mutable std::atomic<std::size_t> xs_cache_misses_{0};
+
   private:
     VecModel build_models(ActionRegistry*) const;
     void build_options(Options const&, HostValue*) const;
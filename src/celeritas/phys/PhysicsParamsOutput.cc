@@ -113,6 +113,16 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         obj["sizes"] = std::move(sizes);
     }
 
+    // Save cross section cache counters if enabled
+    if (physics_->host_ref().scalars.count_xs_cache)
+    {
+        auto counts = physics_->xs_cache_counts();
+        obj["xs_cache"] = {
+            {"hits", counts.hits},
+            {"misses", counts.misses},
+        };
+    }
+
     j->obj = std::move(obj);
 }
 
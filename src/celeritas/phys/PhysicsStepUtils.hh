@@ -88,27 +88,17 @@ inline CELER_FUNCTION ParticleProcessId find_ppid(
 
 //---------------------------------------------------------------------------//
 /*!
- * Calculate physics step limits based on cross sections and range limiters.
+ * Calculate and store the per-process and total macroscopic cross sections.
  *
  * Processes with integral cross section rejection calculate an estimated
  * "maximum" over the step: see PhysicsTrackView.calc_max_xs .
- *
- * \todo For particles with decay, macro XS calculation will incorporate
- * decay probability, dividing decay constant by speed to become 1/len to
- * compete with interactions.
- *
- * \todo For neutral particles that haven't changed material since the last
- * step, we can reuse the previously calculated cross section (but may not want
- * to if it's expensive).
  */
-inline CELER_FUNCTION StepLimit calc_physics_step_limit(
-    MaterialTrackView const& material,
-    ParticleTrackView const& particle,
-    PhysicsTrackView& physics,
-    PhysicsStepView& pstep)
+inline CELER_FUNCTION real_type
+calc_macro_xs(MaterialTrackView const& material,
+              ParticleTrackView const& particle,
+              PhysicsTrackView const& physics,
+              PhysicsStepView& pstep)
 {
-    CELER_EXPECT(physics.has_interaction_mfp());
-
     // Loop over all processes that apply to this track (based on particle
     // type) and calculate cross section and particle range.
     real_type total_macro_xs = 0;
@@ -134,6 +124,40 @@ inline CELER_FUNCTION StepLimit calc_physics_step_limit(
         pstep.per_process_xs(ppid) = process_xs;
     }
     pstep.macro_xs(total_macro_xs);
+    return total_macro_xs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate physics step limits based on cross sections and range limiters.
+ *
+ * If the particle type, material, and energy are unchanged since the previous
+ * step in this track slot (e.g., a photon crossing a boundary between two
+ * volumes of the same material), the previously calculated cross sections are
+ * reused.
+ *
+ * \todo For particles with decay, macro XS calculation will incorporate
+ * decay probability, dividing decay constant by speed to become 1/len to
+ * compete with interactions.
+ */
+inline CELER_FUNCTION StepLimit calc_physics_step_limit(
+    MaterialTrackView const& material,
+    ParticleTrackView const& particle,
+    PhysicsTrackView& physics,
+    PhysicsStepView& pstep)
+{
+    CELER_EXPECT(physics.has_interaction_mfp());
+
+    real_type total_macro_xs = 0;
+    if (pstep.reuse_xs(
+            particle.particle_id(), physics.material_id(), particle.energy()))
+    {
+        total_macro_xs = pstep.macro_xs();
+    }
+    else
+    {
+        total_macro_xs = calc_macro_xs(material, particle, physics, pstep);
+    }
     CELER_ASSERT(total_macro_xs > 0 || !particle.is_stopped());
 
     // Determine limits from discrete interactions
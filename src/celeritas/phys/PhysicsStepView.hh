@@ -57,6 +57,9 @@ class PhysicsStepView
     // Set the sampled element
     inline CELER_FUNCTION void element(ElementComponentId);
 
+    // Whether the previous step's cross sections are valid, else update key
+    inline CELER_FUNCTION bool reuse_xs(ParticleId, PhysMatId, Energy);
+
     // Save MSC step data
     inline CELER_FUNCTION void msc_step(MscStep const&);
 
@@ -154,6 +157,44 @@ CELER_FUNCTION void PhysicsStepView::element(ElementComponentId elcomp_id)
     this->state().element = elcomp_id;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the previous step's cross sections are valid, else update the key.
+ *
+ * The per-process and total macroscopic cross sections depend only on the
+ * particle type, material, and energy. Neutral particles often take several
+ * steps (e.g., across geometry boundaries) without changing any of these, so
+ * the values calculated at the previous step can be reused exactly. If the
+ * key doesn't match, it is updated and the caller must recalculate the
+ * cross sections. Reuse is only counted if the \c count_xs_cache diagnostic
+ * option is enabled.
+ */
+CELER_FUNCTION bool PhysicsStepView::reuse_xs(ParticleId particle,
+                                              PhysMatId material,
+                                              Energy energy)
+{
+    CELER_EXPECT(particle && material);
+
+    auto& s = this->state();
+    if (s.xs_particle == particle && s.xs_material == material
+        && s.xs_energy == energy.value())
+    {
+        if (params_.scalars.count_xs_cache)
+        {
+            ++states_.xs_cache_hits[track_slot_];
+        }
+        return true;
+    }
+    s.xs_particle = particle;
+    s.xs_material = material;
+    s.xs_energy = energy.value();
+    if (params_.scalars.count_xs_cache)
+    {
+        ++states_.xs_cache_misses[track_slot_];
+    }
+    return false;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Save MSC step limit data.
@@ -216,12 +216,16 @@ CELER_FUNCTION PhysicsTrackView::PhysicsTrackView(
 //---------------------------------------------------------------------------//
 /*!
  * Initialize the track view.
+ *
+ * This invalidates any cross sections cached by the previous track in the
+ * slot.
  */
 CELER_FUNCTION PhysicsTrackView& PhysicsTrackView::operator=(
     Initializer_t const&)
 {
     this->state().interaction_mfp = 0;
     this->state().msc_range = {};
+    this->state().xs_particle = {};
     return *this;
 }
 
@@ -14,10 +14,11 @@
 #include "corecel/cont/VariantUtils.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StringUtils.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "celeritas/io/EventIOInterface.hh"
 #include "celeritas/io/EventReader.hh"
 #include "celeritas/io/JsonEventReader.hh"
+#include "celeritas/io/PrefetchEventReader.hh"
 #include "celeritas/io/RootEventReader.hh"
 #include "celeritas/phys/Primary.hh"
 #include "celeritas/phys/PrimaryGenerator.hh"
@@ -61,19 +62,19 @@ auto read_events(EventReaderInterface& generate, bool merge)
 
 //---------------------------------------------------------------------------//
 /*!
- * Load events from a file.
+ * Create a reader for the event generation mechanism.
+ *
+ * If prefetching is enabled, the reader is wrapped so that events are read
+ * on a background thread.
  */
-std::vector<std::vector<Primary>> events(
+std::unique_ptr<EventReaderInterface> event_reader(
     inp::Events const& e,
     std::shared_ptr<ParticleParams const> const& particles)
 {
     CELER_EXPECT(particles);
 
-    CELER_LOG(status) << "Loading events";
-    ScopedProfiling profile_this{"setup::events"};
-
     using UP_ERI = std::unique_ptr<EventReaderInterface>;
-    auto generator = std::visit(
+    auto result = std::visit(
         return_as<UP_ERI>(Overload{
             [&particles](inp::CorePrimaryGenerator const& pg) {
                 return std::make_unique<PrimaryGenerator>(pg, *particles);
@@ -106,6 +107,28 @@ std::vector<std::vector<Primary>> events(
         }),
         e.generator);
 
+    if (e.prefetch > 0)
+    {
+        result = std::make_unique<PrefetchEventReader>(std::move(result),
+                                                       e.prefetch);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load events from a file.
+ */
+std::vector<std::vector<Primary>> events(
+    inp::Events const& e,
+    std::shared_ptr<ParticleParams const> const& particles)
+{
+    CELER_EXPECT(particles);
+
+    CELER_LOG(status) << "Loading events";
+    ScopedSetupPhase record_phase{"setup::events"};
+
+    auto generator = event_reader(e, particles);
     return read_events(*generator, e.merge);
 }
 
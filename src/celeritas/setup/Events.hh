@@ -14,11 +14,17 @@
 namespace celeritas
 {
 struct Primary;
+class EventReaderInterface;
 class ParticleParams;
 
 namespace setup
 {
 //---------------------------------------------------------------------------//
+// Create a reader for the event generation mechanism
+std::unique_ptr<EventReaderInterface> event_reader(
+    inp::Events const& inp,
+    std::shared_ptr<ParticleParams const> const& particles);
+
 // Load events
 std::vector<std::vector<Primary>> events(
     inp::Events const& inp,
@@ -11,7 +11,7 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/io/Logger.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "celeritas/ext/GeantImporter.hh"
 #include "celeritas/ext/RootImporter.hh"
 #include "celeritas/io/AtomicRelaxationReader.hh"
@@ -72,7 +72,7 @@ class AllElementReader
  */
 void physics_from(inp::PhysicsFromFile const& pff, ImportData& imported)
 {
-    ScopedProfiling profile_this{"load-physics-root"};
+    ScopedSetupPhase record_phase{"load-physics-root"};
 
     CELER_VALIDATE(!pff.input.empty(), << "no file import specified");
     // Import all physics data from ROOT file
@@ -85,7 +85,7 @@ void physics_from(inp::PhysicsFromFile const& pff, ImportData& imported)
  */
 void physics_from(inp::PhysicsFromGeant const& pfg, ImportData& imported)
 {
-    ScopedProfiling profile_this{"load-physics-geant"};
+    ScopedSetupPhase record_phase{"load-physics-geant"};
     imported = GeantImporter{}(pfg.data_selection);
 }
 
@@ -100,7 +100,7 @@ void physics_from(inp::PhysicsFromGeantFiles const& pfgf, ImportData& imported)
 {
     CELER_EXPECT(!imported.elements.empty());
 
-    ScopedProfiling profile_this{"load-physics-files"};
+    ScopedSetupPhase record_phase{"load-physics-files"};
 
     AllElementReader load_data{imported.elements};
     auto have_process = [&imported](ImportProcessClass ipc) {
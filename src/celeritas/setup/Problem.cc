@@ -23,7 +23,7 @@
 #include "corecel/sys/ActionRegistry.hh"
 #include "corecel/sys/ActionRegistryOutput.hh"
 #include "corecel/sys/Device.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "geocel/GeantGdmlLoader.hh"
 #include "geocel/SurfaceParams.hh"
 #include "celeritas/Quantities.hh"
@@ -154,6 +154,7 @@ auto build_physics(inp::Problem const& p,
           / static_cast<real_type>(params.sizes.tracks);
     input.options.linear_loss_limit = imported.em_params.linear_loss_limit;
     input.options.disable_integral_xs = !imported.em_params.integral_approach;
+    input.options.count_xs_cache = p.diagnostics.counters.xs_cache;
     input.options.light.lowest_energy
         = ParticleOptions::Energy(imported.em_params.lowest_electron_energy);
     input.options.heavy.lowest_energy
@@ -300,7 +301,8 @@ auto build_optical_params(
         pi.gen_reg,
         pi.sizes.generators);
     pi.rng = core.rng();
-    pi.sim = std::make_shared<optical::SimParams>(p.tracking.optical_limits);
+    pi.sim = std::make_shared<optical::SimParams>(
+        p.tracking.optical_limits, p.tracking.optical_biasing);
     pi.surface = core.surface();
     pi.surface_physics = std::make_shared<optical::SurfacePhysicsParams>(
         pi.action_reg.get(), p.physics.optical.surfaces);
@@ -365,7 +367,7 @@ auto build_optical_params(inp::OpticalProblem const& p,
         pi.gen_reg,
         pi.sizes.generators);
     pi.rng = std::make_shared<RngParams>(p.seed);
-    pi.sim = std::make_shared<optical::SimParams>(p.limits);
+    pi.sim = std::make_shared<optical::SimParams>(p.limits, p.biasing);
     pi.surface = std::move(loaded_model.surface);
     pi.surface_physics = std::make_shared<optical::SurfacePhysicsParams>(
         pi.action_reg.get(), p.physics.surfaces);
@@ -425,17 +427,16 @@ auto build_optical_offload(
     oc_inp.num_track_slots = ceil_div(sizes.tracks, sizes.streams);
     oc_inp.buffer_capacity = ceil_div(sizes.generators, sizes.streams);
     oc_inp.auto_flush = ceil_div(sizes.primaries, sizes.streams);
-    oc_inp.action_times = [&p] {
-        if (!celeritas::device())
-        {
-            return true;
-        }
-        if (p.control.device_debug)
-        {
-            return p.control.device_debug->sync_stream;
-        }
-        return false;
-    }();
+    oc_inp.interleave_step_iters
+        = p.tracking.optical_limits.interleave_step_iters;
+    oc_inp.photon_scale = p.tracking.optical_biasing.photon_scale;
+    CELER_VALIDATE(oc_inp.photon_scale >= 1,
+                   << "invalid optical photon scale " << oc_inp.photon_scale
+                   << " (should be at least 1)");
+    oc_inp.sync_stream = p.control.device_debug
+                         && p.control.device_debug->sync_stream;
+    oc_inp.action_times = !celeritas::device() || p.diagnostics.timers.action
+                          || oc_inp.sync_stream;
 
     CELER_ENSURE(oc_inp);
 
@@ -459,7 +460,7 @@ ProblemLoaded problem(inp::Problem const& p, ImportData const& imported)
 {
     CELER_LOG(status) << "Initializing problem";
 
-    ScopedProfiling profile_this{"problem"};
+    ScopedSetupPhase record_phase{"problem"};
 
     CoreParams::Input params;
 
@@ -479,6 +480,8 @@ ProblemLoaded problem(inp::Problem const& p, ImportData const& imported)
 
     // Load geometry and model
     {
+        ScopedSetupPhase record_model{"model"};
+
         if (auto* filename = std::get_if<std::string>(&p.model.geometry))
         {
             CELER_VALIDATE(!filename->empty(),
@@ -516,29 +519,34 @@ ProblemLoaded problem(inp::Problem const& p, ImportData const& imported)
         params.detectors = std::move(loaded_model.detector);
     }
 
-    // Load materials
-    params.material = MaterialParams::from_import(imported);
+    // Load materials and physics
+    {
+        ScopedSetupPhase record_physics{"physics"};
+
+        // Load materials
+        params.material = MaterialParams::from_import(imported);
 
-    // Create geometry/material coupling
-    params.geomaterial = GeoMaterialParams::from_import(
-        imported, params.geometry, params.volume, params.material);
+        // Create geometry/material coupling
+        params.geomaterial = GeoMaterialParams::from_import(
+            imported, params.geometry, params.volume, params.material);
 
-    // Construct particle params
-    params.particle = ParticleParams::from_import(imported);
+        // Construct particle params
+        params.particle = ParticleParams::from_import(imported);
 
-    // Construct cutoffs
-    params.cutoff = CutoffParams::from_import(
-        imported, params.particle, params.material);
+        // Construct cutoffs
+        params.cutoff = CutoffParams::from_import(
+            imported, params.particle, params.material);
 
-    // Construct shared data for Coulomb scattering
-    params.wentzel = WentzelOKVIParams::from_import(
-        imported, params.material, params.particle);
+        // Construct shared data for Coulomb scattering
+        params.wentzel = WentzelOKVIParams::from_import(
+            imported, params.material, params.particle);
 
-    // Load physics: create individual processes with make_shared
-    params.physics = build_physics(p, params, imported);
+        // Load physics: create individual processes with make_shared
+        params.physics = build_physics(p, params, imported);
 
-    CELER_ASSUME(!p.field.valueless_by_exception());
-    params.action_reg->insert(build_along_step(p.field, params, imported));
+        CELER_ASSUME(!p.field.valueless_by_exception());
+        params.action_reg->insert(build_along_step(p.field, params, imported));
+    }
 
     // Construct RNG params
     params.rng = std::make_shared<RngParams>(p.control.seed);
@@ -554,7 +562,10 @@ ProblemLoaded problem(inp::Problem const& p, ImportData const& imported)
     params.init = build_track_init(p.control, params);
 
     // Construct core
-    auto core_params = std::make_shared<CoreParams>(std::move(params));
+    auto core_params = [&params] {
+        ScopedSetupPhase record_core{"core-params"};
+        return std::make_shared<CoreParams>(std::move(params));
+    }();
 
     ProblemLoaded result;
     result.core_params = core_params;
@@ -717,6 +728,8 @@ ProblemLoaded problem(inp::Problem const& p, ImportData const& imported)
                                   "any geometry surface definitions: default "
                                   "physics will be used for all surfaces";
         }
+        ScopedSetupPhase record_optical{"optical-params"};
+
         // Construct the optical params from the core params
         auto optical_params = build_optical_params(p, *core_params, imported);
 
@@ -737,12 +750,16 @@ ProblemLoaded problem(inp::Problem const& p, ImportData const& imported)
     result.actions = [&] {
         ActionSequence::Options opt;
         auto const& action_reg = core_params->action_reg();
-        if (!celeritas::device() || p.diagnostics.timers.action
-            || (p.control.device_debug && p.control.device_debug->sync_stream))
+        bool const sync_stream = p.control.device_debug
+                                 && p.control.device_debug->sync_stream;
+        if (!celeritas::device() || p.diagnostics.timers.action || sync_stream)
         {
             // Create aux data to accumulate action times
-            opt.action_times = ActionTimes::make_and_insert(
-                action_reg, core_params->aux_reg(), "action-times");
+            opt.action_times
+                = ActionTimes::make_and_insert(action_reg,
+                                               core_params->aux_reg(),
+                                               "action-times",
+                                               sync_stream);
         }
         if (p.diagnostics.timers.step)
         {
@@ -773,11 +790,15 @@ OpticalProblemLoaded problem(inp::OpticalProblem const& p,
 {
     CELER_LOG(status) << "Initializing problem";
 
-    ScopedProfiling profile_this{"problem"};
+    ScopedSetupPhase record_phase{"problem"};
 
     CELER_VALIDATE(!imported.optical_materials.empty(),
                    << "an optical tracking loop was requested but no optical "
                       "materials are present");
+    CELER_VALIDATE(p.biasing.photon_scale == 1,
+                   << "optical photon scaling is not supported without the "
+                      "main stepping loop (photon scale is "
+                   << p.biasing.photon_scale << ")");
 
     // Load geometry and model
     if (auto* filename = std::get_if<std::string>(&p.model.geometry))
@@ -7,7 +7,10 @@
 #include "StandaloneInput.hh"
 
 #include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <variant>
 
@@ -15,17 +18,23 @@
 #include "corecel/cont/VariantUtils.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/Environment.hh"
 #include "corecel/sys/Openmp.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "geocel/GeantGeoParams.hh"
 #include "geocel/inp/Model.hh"
+#include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
 #include "celeritas/ext/GeantSetup.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/inp/Control.hh"
 #include "celeritas/inp/Import.hh"
+#include "celeritas/inp/ImportIO.json.hh"
 #include "celeritas/inp/Problem.hh"
 #include "celeritas/inp/StandaloneInput.hh"
 #include "celeritas/io/EventReader.hh"
 #include "celeritas/io/ImportData.hh"
+#include "celeritas/io/ImportDataCache.hh"
 #include "celeritas/io/JsonEventReader.hh"
 #include "celeritas/io/RootEventReader.hh"
 
@@ -38,6 +47,40 @@ namespace celeritas
 {
 namespace setup
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Hash all inputs that affect the physics data imported from Geant4.
+ *
+ * This includes the geometry file contents (which define the materials), the
+ * Geant4 physics options, the import selection, and the Geant4 data
+ * directory used to load additional element data.
+ */
+std::uint64_t hash_import_inputs(std::string const& filename,
+                                 GeantPhysicsOptions const& options,
+                                 inp::PhysicsFromGeant pfg)
+{
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open geometry file at '" << filename
+                   << "'");
+    std::ostringstream inputs;
+    inputs << infile.rdbuf();
+
+    // Exclude the cache file name itself
+    pfg.cache_file.clear();
+    inputs << '\0' << filename << '\0' << nlohmann::json(options).dump()
+           << '\0' << nlohmann::json(pfg).dump() << '\0'
+           << celeritas::getenv("G4LEDATA");
+
+    std::string const str = std::move(inputs).str();
+    return hash_as_bytes(Span<char const>{str.data(), str.size()});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Completely set up a Celeritas problem from a standalone input.
@@ -47,12 +90,16 @@ StandaloneLoaded standalone_input(inp::StandaloneInput& si)
     // Set up system
     setup::system(si.system);
 
+    ScopedSetupPhase record_phase{"standalone-input"};
+
     CELER_ASSUME(
         std::holds_alternative<std::string>(si.problem.model.geometry));
     std::shared_ptr<GeantGeoParams> ggp;
 
     // Import physics data from Geant4 or ROOT: see Import.hh
     ImportData imported;
+    bool loaded_from_cache{false};
+    std::optional<std::uint64_t> write_cache_hash;
     std::visit(Overload{
                    [&](inp::PhysicsFromFile const& pff) {
                        // Load model directly (when loading ROOT physics)
@@ -62,15 +109,8 @@ StandaloneLoaded standalone_input(inp::StandaloneInput& si)
                        setup::physics_from(pff, imported);
                    },
                    [&](inp::PhysicsFromGeant& pfg) {
-                       // Take file name from problem and physics options from
-                       // the arguments, and set up Geant4
-                       GeantSetup geant_setup(
-                           std::get<std::string>(si.problem.model.geometry),
-                           si.geant_setup);
-
-                       // Keep the geant4 geometry and set it as global
-                       ggp = geant_setup.geo_params();
-                       CELER_ASSERT(ggp);
+                       auto const& filename
+                           = std::get<std::string>(si.problem.model.geometry);
 
                        // Adjust Geant4 data selection based on physics options
                        GeantImportDataSelection::Flags selection
@@ -85,6 +125,31 @@ StandaloneLoaded standalone_input(inp::StandaloneInput& si)
                        }
                        pfg.data_selection.particles = selection;
                        pfg.data_selection.processes = selection;
+
+                       if (!pfg.cache_file.empty())
+                       {
+                           auto hash = hash_import_inputs(
+                               filename, si.geant_setup, pfg);
+                           if (auto cached
+                               = read_import_cache(pfg.cache_file, hash))
+                           {
+                               // Skip Geant4 physics construction entirely
+                               imported = std::move(*cached);
+                               ggp = GeantGeoParams::from_gdml(filename);
+                               loaded_from_cache = true;
+                               return;
+                           }
+                           write_cache_hash = hash;
+                       }
+
+                       // Take file name from problem and physics options from
+                       // the arguments, and set up Geant4
+                       GeantSetup geant_setup(filename, si.geant_setup);
+
+                       // Keep the geant4 geometry and set it as global
+                       ggp = geant_setup.geo_params();
+                       CELER_ASSERT(ggp);
+
                        setup::physics_from(pfg, imported);
                    },
                },
@@ -94,8 +159,26 @@ StandaloneLoaded standalone_input(inp::StandaloneInput& si)
     // pointer
     si.problem.model = ggp->make_model_input();
 
-    // Load from external Geant4 data files
-    setup::physics_from(inp::PhysicsFromGeantFiles{}, imported);
+    if (!loaded_from_cache)
+    {
+        // Load from external Geant4 data files
+        setup::physics_from(inp::PhysicsFromGeantFiles{}, imported);
+    }
+    if (write_cache_hash)
+    {
+        // Save the complete imported data for subsequent runs: since the
+        // cache is only an optimization, failure is not fatal
+        auto const& pfg = std::get<inp::PhysicsFromGeant>(si.physics_import);
+        try
+        {
+            write_import_cache(pfg.cache_file, *write_cache_hash, imported);
+        }
+        catch (std::exception const& e)
+        {
+            CELER_LOG(warning)
+                << "Failed to write imported data cache: " << e.what();
+        }
+    }
 
     // Copy optical physics from import data
     // (TODO: will be replaced)
@@ -139,9 +222,23 @@ StandaloneLoaded standalone_input(inp::StandaloneInput& si)
     // Save geometry if loaded
     result.geant_geo = ggp;
 
-    // Load events
-    result.events = events(si.events, result.problem.core_params->particle());
-    CELER_ENSURE(ctl.num_streams <= result.events.size());
+    if (si.events.prefetch > 0)
+    {
+        // Read events lazily during the run
+        CELER_VALIDATE(!si.events.merge && !si.events.largest_first,
+                       << "event prefetching is incompatible with merged "
+                          "or energy-ordered events");
+        result.event_reader = event_reader(
+            si.events, result.problem.core_params->particle());
+        CELER_ENSURE(ctl.num_streams <= result.event_reader->num_events());
+    }
+    else
+    {
+        // Load events
+        result.events
+            = events(si.events, result.problem.core_params->particle());
+        CELER_ENSURE(ctl.num_streams <= result.events.size());
+    }
 
     return result;
 }
@@ -155,6 +252,8 @@ OpticalStandaloneLoaded standalone_input(inp::OpticalStandaloneInput& si)
     // Set up system
     setup::system(si.system);
 
+    ScopedSetupPhase record_phase{"standalone-input"};
+
     // Get optical physics options and deactivate everything else
     GeantPhysicsOptions gpo = GeantPhysicsOptions::deactivated();
     gpo.optical = si.geant_setup;
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "celeritas/io/EventIOInterface.hh"
 #include "celeritas/phys/Primary.hh"
 
 #include "Problem.hh"
@@ -36,8 +37,10 @@ struct StandaloneLoaded
     ProblemLoaded problem;
     //! Loaded Geant4 geometry (if inp.geant_setup)
     std::shared_ptr<GeantGeoParams> geant_geo;
-    //! Events to be run
+    //! Events to be run (if not streamed)
     VecEvent events;
+    //! Source of events to be read during the run (if streamed)
+    std::unique_ptr<EventReaderInterface> event_reader;
 };
 
 //---------------------------------------------------------------------------//
@@ -9,9 +9,11 @@
 #include <map>
 #include <optional>
 
+#include "corecel/data/SharedHostParams.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
+#include "corecel/sys/MpiCommunicator.hh"
 #include "celeritas/inp/System.hh"
 
 namespace celeritas
@@ -43,6 +45,20 @@ void system(inp::System const& sys)
 
     // TODO: set up MPI communicator
 
+    if (sys.share_params)
+    {
+        if (auto const& comm = comm_node(); comm.size() > 1)
+        {
+            // Store host params data in memory shared across the node
+            shared_host_params() = SharedHostParams{comm};
+        }
+        else
+        {
+            CELER_LOG(warning) << "Ignoring 'share_params' option: only one "
+                                  "process is running on this node";
+        }
+    }
+
     if (sys.device)
     {
         // TODO: if using MPI, use communicator
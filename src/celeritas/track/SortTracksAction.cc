@@ -64,6 +64,7 @@ SortTracksAction::SortTracksAction(ActionId id, TrackOrder track_order)
                 // along-step
                 return StepActionOrder::sort_pre_post;
             case TrackOrder::reindex_particle_type:
+            case TrackOrder::reindex_volume:
                 // Sort at the beginning of the step
                 return StepActionOrder::sort_start;
             default:
@@ -88,6 +89,8 @@ std::string_view SortTracksAction::label() const
             return "sort-tracks-post-step";
         case TrackOrder::reindex_particle_type:
             return "sort-tracks-start";
+        case TrackOrder::reindex_volume:
+            return "sort-tracks-volume";
         default:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -96,16 +99,26 @@ std::string_view SortTracksAction::label() const
 /*!
  * Execute the action with host data.
  */
-void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
+void SortTracksAction::step(CoreParams const& params,
+                            CoreStateHost& state) const
 {
-    detail::sort_tracks(state.ref(), track_order_);
-    if (is_sort_by_action(track_order_))
+    if (track_order_ == TrackOrder::reindex_volume)
     {
-        detail::count_tracks_per_action(
-            state.ref(),
-            state.action_thread_offsets()[AllItems<ThreadId, MemSpace::host>{}],
-            state.action_thread_offsets(),
-            track_order_);
+        detail::sort_tracks_by_volume(params, state);
+    }
+    else if (is_sort_by_action(track_order_))
+    {
+        // The counting sort calculates the action offsets as it sorts
+        auto& offsets = state.action_thread_offsets();
+        detail::sort_tracks(state.ref(),
+                            track_order_,
+                            offsets[AllItems<ThreadId, MemSpace::host>{}],
+                            state.sort_scratch());
+    }
+    else
+    {
+        detail::sort_tracks(
+            state.ref(), track_order_, {}, state.sort_scratch());
     }
 }
 
@@ -113,8 +126,14 @@ void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
 /*!
  * Execute the action with device data.
  */
-void SortTracksAction::step(CoreParams const&, CoreStateDevice& state) const
+void SortTracksAction::step(CoreParams const& params,
+                            CoreStateDevice& state) const
 {
+    if (track_order_ == TrackOrder::reindex_volume)
+    {
+        detail::sort_tracks_by_volume(params, state);
+        return;
+    }
     detail::sort_tracks(state.ref(), track_order_);
     if (is_sort_by_action(track_order_))
     {
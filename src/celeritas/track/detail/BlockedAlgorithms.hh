@@ -0,0 +1,260 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/BlockedAlgorithms.hh
+//! \brief Host-parallel scan and partition over contiguous blocks
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "corecel/Config.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Openmp.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Thread index and thread count inside a parallel region
+struct BlockIndex
+{
+    size_type index;
+    size_type count;
+
+    //! Get the first element of this thread's block out of \c n elements
+    size_type begin(size_type n) const
+    {
+        return static_cast<size_type>(std::size_t(n) * index / count);
+    }
+
+    //! Get one past the last element of this thread's block
+    size_type end(size_type n) const
+    {
+        return static_cast<size_type>(std::size_t(n) * (index + 1) / count);
+    }
+};
+
+inline BlockIndex this_block()
+{
+#ifdef _OPENMP
+    return {static_cast<size_type>(omp_get_thread_num()),
+            static_cast<size_type>(omp_get_num_threads())};
+#else
+    return {0, 1};
+#endif
+}
+
+inline size_type max_blocks()
+{
+#ifdef _OPENMP
+    return static_cast<size_type>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether to use the thread-parallel host algorithms.
+ *
+ * Track-level parallelism must be enabled (in event-parallel mode the caller
+ * is already inside a parallel region), and below this size the cost of
+ * spawning the parallel region outweighs the serial work.
+ */
+inline bool use_blocked(size_type size)
+{
+    constexpr size_type min_parallel_size = 16384;
+    return CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+           && size >= min_parallel_size && openmp_max_threads() > 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Exclusive prefix sum using one contiguous block per OpenMP thread.
+ *
+ * Each thread sums its block, a single thread scans the per-block totals, and
+ * then each thread rescans its block starting from its block offset. This
+ * reads the data twice but scales with the thread count. As with the serial
+ * scan in \c exclusive_scan_counts , the final element of the result (i.e.
+ * the sum of all but the last input) is returned.
+ */
+template<class T>
+T blocked_exclusive_scan(T* data, size_type size)
+{
+    CELER_EXPECT(data || size == 0);
+
+    std::vector<T> offsets(max_blocks() + 1, T{0});
+
+#ifdef _OPENMP
+#    pragma omp parallel
+#endif
+    {
+        auto const block = this_block();
+        size_type const begin = block.begin(size);
+        size_type const end = block.end(size);
+
+        // Sum this block
+        T local{0};
+        for (size_type i = begin; i != end; ++i)
+        {
+            local += data[i];
+        }
+        offsets[block.index + 1] = local;
+
+#ifdef _OPENMP
+#    pragma omp barrier
+#    pragma omp single
+#endif
+        {
+            // Unused trailing entries are zero so the last is the total
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        }
+
+        // Scan this block starting from the sum of previous blocks
+        T acc = offsets[block.index];
+        for (size_type i = begin; i != end; ++i)
+        {
+            T current = data[i];
+            data[i] = acc;
+            acc += current;
+        }
+    }
+
+    return size > 0 ? data[size - 1] : T{0};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Inclusive prefix sum of transformed values using one block per thread.
+ *
+ * This uses the same two-pass algorithm as \c blocked_exclusive_scan but
+ * writes to a separate output array, applying \c op to each input element
+ * (twice, so it must be cheap and pure). The total is returned.
+ */
+template<class T, class U, class Op>
+U blocked_transform_inclusive_scan(T const* input,
+                                   U* output,
+                                   size_type size,
+                                   Op&& op)
+{
+    CELER_EXPECT((input && output) || size == 0);
+
+    std::vector<U> offsets(max_blocks() + 1, U{0});
+
+#ifdef _OPENMP
+#    pragma omp parallel
+#endif
+    {
+        auto const block = this_block();
+        size_type const begin = block.begin(size);
+        size_type const end = block.end(size);
+
+        // Sum this block
+        U local{0};
+        for (size_type i = begin; i != end; ++i)
+        {
+            local += op(input[i]);
+        }
+        offsets[block.index + 1] = local;
+
+#ifdef _OPENMP
+#    pragma omp barrier
+#    pragma omp single
+#endif
+        {
+            // Unused trailing entries are zero so the last is the total
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        }
+
+        // Scan this block starting from the sum of previous blocks
+        U acc = offsets[block.index];
+        for (size_type i = begin; i != end; ++i)
+        {
+            acc += op(input[i]);
+            output[i] = acc;
+        }
+    }
+
+    return offsets.back();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stable partition using one contiguous block per OpenMP thread.
+ *
+ * Elements satisfying the predicate are moved to the front and the others to
+ * the back, preserving relative order within each group as with \c
+ * std::stable_partition . Each thread counts the matching elements in its
+ * block, the counts are scanned to find each block's output offsets, and each
+ * thread scatters its block into a scratch buffer that is then copied back.
+ * The predicate is evaluated twice per element and must be pure.
+ *
+ * \return Number of elements satisfying the predicate
+ */
+template<class T, class Pred>
+size_type blocked_stable_partition(T* data, size_type size, Pred&& pred)
+{
+    CELER_EXPECT(data || size == 0);
+
+    std::vector<size_type> num_true(max_blocks() + 1, 0);
+    std::vector<T> scratch(size);
+
+#ifdef _OPENMP
+#    pragma omp parallel
+#endif
+    {
+        auto const block = this_block();
+        size_type const begin = block.begin(size);
+        size_type const end = block.end(size);
+
+        // Count matching elements in this block
+        size_type local{0};
+        for (size_type i = begin; i != end; ++i)
+        {
+            local += static_cast<size_type>(static_cast<bool>(pred(data[i])));
+        }
+        num_true[block.index + 1] = local;
+
+#ifdef _OPENMP
+#    pragma omp barrier
+#    pragma omp single
+#endif
+        {
+            // Unused trailing entries are zero so the last is the total
+            std::partial_sum(num_true.begin(), num_true.end(), num_true.begin());
+        }
+
+        // Scatter into the scratch space: matching elements before this block
+        // are at the front, and nonmatching ones after all matching
+        size_type true_pos = num_true[block.index];
+        size_type false_pos = num_true.back() + (begin - true_pos);
+        for (size_type i = begin; i != end; ++i)
+        {
+            scratch[pred(data[i]) ? true_pos++ : false_pos++] = data[i];
+        }
+
+#ifdef _OPENMP
+#    pragma omp barrier
+#endif
+        std::copy(scratch.begin() + begin, scratch.begin() + end, data + begin);
+    }
+
+    return num_true.back();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
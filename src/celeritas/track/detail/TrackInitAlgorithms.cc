@@ -11,6 +11,7 @@
 
 #include "corecel/math/Algorithms.hh"
 
+#include "BlockedAlgorithms.hh"
 #include "../Utils.hh"
 
 using namespace celeritas::literals;
@@ -30,8 +31,14 @@ void remove_if_alive(
 {
     auto* start = init.vacancies.data().get();
     auto* counters = init.counters.data().get();
-    auto* stop
-        = std::remove_if(start, start + init.vacancies.size(), LogicalNot{});
+    size_type const size = init.vacancies.size();
+    if (use_blocked(size))
+    {
+        counters->num_vacancies = blocked_stable_partition(
+            start, size, [](TrackSlotId tid) { return static_cast<bool>(tid); });
+        return;
+    }
+    auto* stop = std::remove_if(start, start + size, LogicalNot{});
     counters->num_vacancies = stop - start;
     return;
 }
@@ -54,6 +61,10 @@ size_type exclusive_scan_counts(
 {
     CELER_EXPECT(!counts.empty());
     auto* data = counts.data().get();
+    if (use_blocked(counts.size()))
+    {
+        return blocked_exclusive_scan(data, counts.size());
+    }
 #ifdef __cpp_lib_parallel_algorithm
     auto* stop = std::exclusive_scan(data, data + counts.size(), data, 0_sz);
 #else
@@ -91,8 +102,13 @@ void partition_initializers(
     auto* counters = init.counters.data().get();
     auto* stencil = init.initializers.data().get() + counters->num_initializers
                     - count;
-    std::stable_partition(
-        start, end, IsNeutralStencil{params.ptr<MemSpace::native>(), stencil});
+    IsNeutralStencil is_neutral{params.ptr<MemSpace::native>(), stencil};
+    if (use_blocked(count))
+    {
+        blocked_stable_partition(start, count, is_neutral);
+        return;
+    }
+    std::stable_partition(start, end, is_neutral);
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,38 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSortScratch.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/sys/ThreadId.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Reusable host storage for the counting sort of track slots.
+ *
+ * This is owned by the core state so that sorting every step does not
+ * reallocate: the vectors are resized as needed and keep their capacity
+ * between sorts.
+ */
+struct TrackSortScratch
+{
+    //! Per-block histogram, then write position, of each key
+    std::vector<size_type> counts;
+    //! Sort key of each track slot (only used by some orderings)
+    std::vector<size_type> keys;
+    //! Reordered track slots
+    std::vector<TrackSlotId::size_type> sorted;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
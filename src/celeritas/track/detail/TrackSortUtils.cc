@@ -9,8 +9,17 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <vector>
 
+#include "corecel/Config.hh"
 #include "corecel/data/Collection.hh"
+#include "geocel/GeoParamsInterface.hh"
+#include "celeritas/geo/CoreGeoParams.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+
+#include "BlockedAlgorithms.hh"
 
 namespace celeritas
 {
@@ -27,38 +36,156 @@ using ThreadItems
 using TrackSlots = ThreadItems<TrackSlotId::size_type>;
 
 //---------------------------------------------------------------------------//
-//! Partition track slots based on a unary predicate
-template<class F>
-void partition_impl(TrackSlots const& track_slots, F&& func)
+//! Map a track slot to a sort key by indirection through an ID array
+template<class Id>
+struct IdKey
 {
-    auto* start = track_slots.data().get();
-    std::partition(start, start + track_slots.size(), std::forward<F>(func));
-}
+    ObserverPtr<Id const> ids_;
+    size_type invalid_key;
+
+    size_type operator()(size_type track_slot) const
+    {
+        Id id = ids_.get()[track_slot];
+        return id ? id.unchecked_get() : invalid_key;
+    }
+};
+
+template<class Id>
+IdKey(ObserverPtr<Id>, size_type) -> IdKey<Id>;
 
 //---------------------------------------------------------------------------//
-//! Sort track slots based on a binary predicate
-template<class F>
-void sort_impl(TrackSlots const& track_slots, F&& func)
+//! Map a track slot to zero if active and one if inactive
+struct InactiveKey
+{
+    IsNotInactive is_not_inactive;
+
+    size_type operator()(size_type track_slot) const
+    {
+        return is_not_inactive(track_slot) ? 0 : 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Get one past the largest valid ID in a state array
+template<class Id, MemSpace M>
+size_type calc_num_ids(ObserverPtr<Id, M> ids, size_type size)
 {
-    auto* start = track_slots.data().get();
-    std::sort(start, start + track_slots.size(), std::forward<F>(func));
+    auto const* data = ids.get();
+    size_type result = 0;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for reduction(max : result)
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        if (data[i])
+        {
+            result = std::max(result, data[i].unchecked_get() + 1);
+        }
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
-//! Compare indices by indirection from a track slot index
-template<class Id>
-struct IdLess
+/*!
+ * Reorder track slots with a stable counting sort on a small integer key.
+ *
+ * Each thread histograms the keys of a contiguous block of track slots, the
+ * histograms are scanned in key-major order to find where each block writes
+ * each key, and each block scatters its slots into a temporary. The keys must
+ * be less than \c num_keys . If \c key_offsets is nonempty, the start of each
+ * key is written to it, and its final element (which must not be a key) is the
+ * number of track slots. The temporaries are stored in \c scratch so that
+ * repeated sorts reuse their allocations.
+ */
+template<class F>
+void counting_sort_impl(TrackSlots const& track_slots,
+                        F&& get_key,
+                        size_type num_keys,
+                        Span<ThreadId> key_offsets,
+                        TrackSortScratch& scratch)
 {
-    ObserverPtr<Id const> ids_;
+    CELER_EXPECT(num_keys > 0);
+    CELER_EXPECT(key_offsets.empty() || key_offsets.size() <= num_keys + 1);
 
-    bool operator()(size_type a, size_type b) const
+    // Below this size the parallel region costs more than the sort
+    constexpr size_type min_parallel_size = 4096;
+
+    auto* slots = track_slots.data().get();
+    size_type const size = track_slots.size();
+    int const num_blocks
+        = (CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+           && size >= min_parallel_size)
+              ? static_cast<int>(max_blocks())
+              : 1;
+
+    auto& counts = scratch.counts;
+    auto& sorted = scratch.sorted;
+    counts.assign(num_keys * num_blocks, 0);
+    sorted.resize(size);
+
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel num_threads(num_blocks)
+#endif
     {
-        return ids_.get()[a] < ids_.get()[b];
+        // Only query the thread if this function opened the parallel region:
+        // otherwise (e.g. in event-parallel mode) the caller may be inside
+        // another team
+        auto const block = (CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK)
+                               ? this_block()
+                               : BlockIndex{0, 1};
+        size_type const begin = block.begin(size);
+        size_type const end = block.end(size);
+        size_type* block_counts = counts.data() + block.index * num_keys;
+
+        // Histogram keys in this block
+        for (size_type i = begin; i != end; ++i)
+        {
+            size_type key = get_key(slots[i]);
+            CELER_ASSERT(key < num_keys);
+            ++block_counts[key];
+        }
+
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp barrier
+#    pragma omp single
+#endif
+        {
+            // Convert counts to write positions ordered by key, then block
+            size_type acc = 0;
+            for (size_type k = 0; k != num_keys; ++k)
+            {
+                if (k < key_offsets.size())
+                {
+                    key_offsets[k] = ThreadId{acc};
+                }
+                for (size_type b = 0; b != block.count; ++b)
+                {
+                    size_type& c = counts[b * num_keys + k];
+                    size_type current = c;
+                    c = acc;
+                    acc += current;
+                }
+            }
+            CELER_ASSERT(acc == size);
+        }
+
+        // Scatter this block's slots
+        for (size_type i = begin; i != end; ++i)
+        {
+            sorted[block_counts[get_key(slots[i])]++] = slots[i];
+        }
+
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp barrier
+#endif
+        std::copy(sorted.begin() + begin, sorted.begin() + end, slots + begin);
     }
-};
 
-template<class Id>
-IdLess(ObserverPtr<Id>) -> IdLess<Id>;
+    if (!key_offsets.empty())
+    {
+        key_offsets.back() = ThreadId{size};
+    }
+}
 
 //---------------------------------------------------------------------------//
 }  // namespace
@@ -69,23 +196,110 @@ IdLess(ObserverPtr<Id>) -> IdLess<Id>;
  */
 void sort_tracks(HostRef<CoreStateData> const& states, TrackOrder order)
 {
+    TrackSortScratch scratch;
+    return sort_tracks(states, order, {}, scratch);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort or partition tracks, saving the offsets of each action.
+ *
+ * All orderings use a linear-time counting sort, since the keys are small
+ * dense integers. Tracks with an invalid ID are placed last. For action
+ * orderings, if the offsets (of size num_actions + 1) are provided, they are
+ * filled with the same result as \c count_tracks_per_action . Temporary
+ * storage is kept in \c scratch to avoid reallocating it for every sort.
+ */
+void sort_tracks(HostRef<CoreStateData> const& states,
+                 TrackOrder order,
+                 Span<ThreadId> offsets,
+                 TrackSortScratch& scratch)
+{
+    CELER_EXPECT(offsets.empty() || offsets.size() >= 2);
+
+    size_type const size = states.size();
     switch (order)
     {
         case TrackOrder::reindex_status:
-            return partition_impl(states.track_slots,
-                                  IsNotInactive{states.sim.status.data()});
+            return counting_sort_impl(
+                states.track_slots,
+                InactiveKey{IsNotInactive{states.sim.status.data()}},
+                2,
+                {},
+                scratch);
         case TrackOrder::reindex_along_step_action:
-        case TrackOrder::reindex_step_limit_action:
-            return sort_impl(states.track_slots,
-                             IdLess{get_action_ptr(states, order)});
-        case TrackOrder::reindex_particle_type:
-            return sort_impl(states.track_slots,
-                             IdLess{states.particles.particle_id.data()});
+        case TrackOrder::reindex_step_limit_action: {
+            auto actions = get_action_ptr(states, order);
+            size_type num_actions = offsets.empty()
+                                        ? calc_num_ids(actions, size)
+                                        : offsets.size() - 1;
+            return counting_sort_impl(states.track_slots,
+                                      IdKey{actions, num_actions},
+                                      num_actions + 1,
+                                      offsets,
+                                      scratch);
+        }
+        case TrackOrder::reindex_particle_type: {
+            auto particles = states.particles.particle_id.data();
+            size_type num_particles = calc_num_ids(particles, size);
+            return counting_sort_impl(states.track_slots,
+                                      IdKey{particles, num_particles},
+                                      num_particles + 1,
+                                      {},
+                                      scratch);
+        }
         default:
             CELER_ASSERT_UNREACHABLE();
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks by the implementation volume of their current geometry state.
+ *
+ * Tracks that are neighbors in thread space then tend to access the same
+ * geometry data (and nearby field and material data). Inactive tracks and
+ * those outside the geometry are placed last.
+ */
+void sort_tracks_by_volume(CoreParams const& params,
+                           CoreState<MemSpace::host>& state)
+{
+    auto const& params_ref = params.host_ref();
+    auto const& states = state.ref();
+    size_type const size = states.size();
+    size_type const num_volumes = params.geometry()->impl_volumes().size();
+    IsNotInactive is_not_inactive{states.sim.status.data()};
+    auto& scratch = state.sort_scratch();
+
+    // Calculate the volume of each track slot once
+    auto& volumes = scratch.keys;
+    volumes.resize(size);
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type slot = 0; slot < size; ++slot)
+    {
+        ImplVolumeId vol;
+        if (is_not_inactive(slot))
+        {
+            GeoTrackView geo{
+                params_ref.geometry, states.geometry, TrackSlotId{slot}};
+            if (!geo.is_outside())
+            {
+                vol = geo.impl_volume_id();
+            }
+        }
+        volumes[slot] = vol ? vol.unchecked_get() : num_volumes;
+    }
+
+    return counting_sort_impl(
+        states.track_slots,
+        [&volumes](size_type slot) { return volumes[slot]; },
+        num_volumes + 1,
+        {},
+        scratch);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
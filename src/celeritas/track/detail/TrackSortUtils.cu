@@ -22,6 +22,11 @@
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "corecel/sys/Stream.hh"
 #include "corecel/sys/Thrust.device.hh"
+#include "geocel/GeoParamsInterface.hh"
+#include "celeritas/geo/CoreGeoParams.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
 
 namespace celeritas
 {
@@ -101,6 +106,36 @@ void sort_impl(TrackSlots const& track_slots,
     CELER_DEVICE_API_CALL(PeekAtLastError());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the implementation volume of the track at each thread.
+ *
+ * Inactive tracks and those outside the geometry use \c num_volumes .
+ */
+__global__ void volume_keys_kernel(CoreParamsPtr<MemSpace::device> const params,
+                                   CoreStatePtr<MemSpace::device> const state,
+                                   size_type num_volumes,
+                                   ObserverPtr<size_type> keys)
+{
+    ThreadId tid = celeritas::KernelParamCalculator::thread_id();
+    if (!(tid < state->size()))
+    {
+        return;
+    }
+
+    TrackSlotId slot{state->track_slots[tid]};
+    ImplVolumeId vol;
+    if (state->sim.status[slot] != TrackStatus::inactive)
+    {
+        GeoTrackView geo{params->geometry, state->geometry, slot};
+        if (!geo.is_outside())
+        {
+            vol = geo.impl_volume_id();
+        }
+    }
+    keys.get()[tid.get()] = vol ? vol.unchecked_get() : num_volumes;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate thread boundaries based on action ID.
@@ -166,6 +201,29 @@ void sort_tracks(DeviceRef<CoreStateData> const& states, TrackOrder order)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks by the implementation volume of their current geometry state.
+ */
+void sort_tracks_by_volume(CoreParams const& params,
+                           CoreState<MemSpace::device>& state)
+{
+    auto const& states = state.ref();
+    DeviceVector<size_type> keys(states.size(), states.stream_id);
+    CELER_LAUNCH_KERNEL(volume_keys,
+                        states.size(),
+                        celeritas::device().stream(states.stream_id).get(),
+                        params.ptr<MemSpace::native>(),
+                        state.ptr(),
+                        params.geometry()->impl_volumes().size(),
+                        make_observer(keys.data()));
+    thrust::sort_by_key(thrust_execute_on(states.stream_id),
+                        keys.data(),
+                        keys.data() + keys.size(),
+                        device_pointer_cast(states.track_slots.data()));
+    CELER_DEVICE_API_CALL(PeekAtLastError());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
@@ -16,8 +16,14 @@
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/CoreTrackData.hh"
 
+#include "TrackSortScratch.hh"
+
 namespace celeritas
 {
+class CoreParams;
+template<MemSpace M>
+class CoreState;
+
 namespace detail
 {
 //---------------------------------------------------------------------------//
@@ -29,6 +35,17 @@ namespace detail
 void sort_tracks(HostRef<CoreStateData> const&, TrackOrder);
 void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder);
 
+// Sort or partition tracks and save the offsets of each action
+void sort_tracks(HostRef<CoreStateData> const&,
+                 TrackOrder,
+                 Span<ThreadId>,
+                 TrackSortScratch&);
+
+//---------------------------------------------------------------------------//
+// Sort tracks by the geometry volume they are in
+void sort_tracks_by_volume(CoreParams const&, CoreState<MemSpace::host>&);
+void sort_tracks_by_volume(CoreParams const&, CoreState<MemSpace::device>&);
+
 //---------------------------------------------------------------------------//
 // Count tracks associated to each action
 void count_tracks_per_action(
@@ -99,6 +116,12 @@ inline void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder)
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
+inline void
+sort_tracks_by_volume(CoreParams const&, CoreState<MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
 inline void count_tracks_per_action(
     DeviceRef<CoreStateData> const&,
     Span<ThreadId>,
@@ -103,7 +103,9 @@ void ActionDiagnostic::step(CoreParams const& params,
             store_.params<MemSpace::native>(),
             store_.state<MemSpace::native>(state.stream_id(),
                                            this->state_size())});
-    return launch_action(*this, params, state, execute);
+    // Launch on all threads: this post-step action inspects every track, so
+    // it must not be restricted to its own (empty) sorted action range
+    return launch_core(this->label(), params, state, execute);
 }
 
 //---------------------------------------------------------------------------//
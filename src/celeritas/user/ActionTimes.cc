@@ -9,6 +9,8 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/data/AuxParamsRegistry.hh"
 #include "corecel/sys/ActionRegistry.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/Stream.hh"
 
 namespace celeritas
 {
@@ -16,13 +18,14 @@ namespace celeritas
 /*!
  * Construct and add to the aux registry.
  */
-std::shared_ptr<ActionTimes> ActionTimes::make_and_insert(
-    SPActionRegistry const& actions,
-    SPAuxParamsRegistry const& aux,
-    std::string label)
+std::shared_ptr<ActionTimes>
+ActionTimes::make_and_insert(SPActionRegistry const& actions,
+                             SPAuxParamsRegistry const& aux,
+                             std::string label,
+                             bool sync_stream)
 {
     auto result = std::make_shared<ActionTimes>(
-        aux->next_id(), actions, std::move(label));
+        aux->next_id(), actions, std::move(label), sync_stream);
     aux->insert(result);
     return result;
 }
@@ -31,9 +34,14 @@ std::shared_ptr<ActionTimes> ActionTimes::make_and_insert(
 /*!
  * Construct from ID, actions and label.
  */
-ActionTimes::ActionTimes(
-    AuxId aux_id, SPActionRegistry const& action_reg, std::string label)
-    : aux_id_(aux_id), action_reg_(action_reg), label_(std::move(label))
+ActionTimes::ActionTimes(AuxId aux_id,
+                         SPActionRegistry const& action_reg,
+                         std::string label,
+                         bool sync_stream)
+    : aux_id_(aux_id)
+    , action_reg_(action_reg)
+    , label_(std::move(label))
+    , sync_stream_(sync_stream)
 {
     CELER_EXPECT(aux_id_);
     CELER_EXPECT(action_reg);
@@ -43,12 +51,13 @@ ActionTimes::ActionTimes(
 /*!
  * Build core state data for a stream.
  */
-auto ActionTimes::create_state(MemSpace, StreamId, size_type) const -> UPState
+auto ActionTimes::create_state(MemSpace m, StreamId sid, size_type) const
+    -> UPState
 {
-    auto result = std::make_unique<ActionTimesState>();
     auto reg = action_reg_.lock();
-    result->accum_time.resize(reg->num_actions());
-    return result;
+    CELER_ASSERT(reg);
+    return std::make_unique<ActionTimesState>(
+        m, sid, reg->num_actions(), sync_stream_);
 }
 
 //---------------------------------------------------------------------------//
@@ -77,7 +86,7 @@ auto ActionTimes::get_action_times(AuxStateVec const& aux) const -> MapStrDbl
 {
     MapStrDbl result;
     auto reg = action_reg_.lock();
-    auto const& times = this->state(aux).accum_time;
+    auto const times = this->state(aux).accum_time();
     for (auto i : range(times.size()))
     {
         if (times[i] > 0)
@@ -88,5 +97,143 @@ auto ActionTimes::get_action_times(AuxStateVec const& aux) const -> MapStrDbl
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct for a memory space and stream.
+ */
+ActionTimesState::ActionTimesState(MemSpace m,
+                                   StreamId sid,
+                                   size_type num_actions,
+                                   bool sync_stream)
+    : stream_id_{sid}, accum_time_(num_actions, 0.0)
+{
+    CELER_EXPECT(sid);
+    if (m == MemSpace::device && device())
+    {
+        if (sync_stream)
+        {
+            sync_stream_ = true;
+        }
+        else
+        {
+            pending_.resize(num_pending_steps);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing the next action.
+ */
+void ActionTimesState::mark()
+{
+    if (!pending_.empty())
+    {
+        this->push_event(ActionId{});
+        return;
+    }
+    if (sync_stream_)
+    {
+        device().stream(stream_id_).sync();
+    }
+    last_mark_ = Clock::now();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the time since the last mark to an action.
+ */
+void ActionTimesState::record(ActionId aid)
+{
+    CELER_EXPECT(aid < accum_time_.size());
+
+    if (!pending_.empty())
+    {
+        this->push_event(aid);
+        return;
+    }
+    if (sync_stream_)
+    {
+        device().stream(stream_id_).sync();
+    }
+    auto now = Clock::now();
+    accum_time_[aid.unchecked_get()]
+        += std::chrono::duration<double>(now - last_mark_).count();
+    last_mark_ = now;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish a step, reading back device timers from a previous step.
+ *
+ * The buffer for the next step was filled \c num_pending_steps steps ago;
+ * its events are nearly always complete so the readback does not stall.
+ */
+void ActionTimesState::end_step()
+{
+    if (pending_.empty())
+    {
+        return;
+    }
+
+    current_ = (current_ + 1) % pending_.size();
+    auto& step = pending_[current_];
+    ActionTimesState::accumulate(step, &accum_time_);
+    step.size = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated times, waiting for any pending device timers.
+ */
+auto ActionTimesState::accum_time() const -> VecDbl
+{
+    VecDbl result = accum_time_;
+    for (auto const& step : pending_)
+    {
+        ActionTimesState::accumulate(step, &result);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record a timestamped event for the current step.
+ */
+void ActionTimesState::push_event(ActionId aid)
+{
+    auto& step = pending_[current_];
+    if (step.size == step.events.size())
+    {
+        step.events.emplace_back(device(), true);
+        step.actions.emplace_back();
+    }
+    step.actions[step.size] = aid;
+    step.events[step.size].record(device().stream(stream_id_));
+    ++step.size;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the elapsed time between consecutive events to their actions.
+ */
+void ActionTimesState::accumulate(PendingStep const& step, VecDbl* times)
+{
+    if (step.size == 0)
+    {
+        return;
+    }
+
+    step.events[step.size - 1].sync();
+    for (auto i : range(size_type{1}, step.size))
+    {
+        if (ActionId aid = step.actions[i])
+        {
+            (*times)[aid.unchecked_get()]
+                += step.events[i].elapsed_since(step.events[i - 1]);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
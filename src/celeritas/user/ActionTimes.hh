@@ -6,6 +6,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -13,11 +14,13 @@
 #include "corecel/Types.hh"
 #include "corecel/data/AuxInterface.hh"
 #include "corecel/data/AuxStateVec.hh"
+#include "corecel/sys/DeviceEvent.hh"
+#include "corecel/sys/ThreadId.hh"
 
 namespace celeritas
 {
 class ActionRegistry;
-struct ActionTimesState;
+class ActionTimesState;
 class AuxParamsRegistry;
 
 //---------------------------------------------------------------------------//
@@ -30,6 +33,12 @@ class AuxParamsRegistry;
  * the action times are stored as auxiliary data rather than locally in that
  * class.
  *
+ * On device, actions are timed by default with pairs of device events whose
+ * elapsed times are read back a few steps later, so timing does not
+ * synchronize the stream. With \c sync_stream the stream is instead
+ * synchronized after each action, which serializes kernel launches but makes
+ * errors easier to attribute to a specific action.
+ *
  * \todo Add an end-gather action to merge across states?
  */
 class ActionTimes : public AuxParamsInterface
@@ -44,11 +53,17 @@ class ActionTimes : public AuxParamsInterface
 
   public:
     // Construct and add to the aux registry
-    static std::shared_ptr<ActionTimes> make_and_insert(
-        SPActionRegistry const&, SPAuxParamsRegistry const&, std::string label);
+    static std::shared_ptr<ActionTimes>
+    make_and_insert(SPActionRegistry const&,
+                    SPAuxParamsRegistry const&,
+                    std::string label,
+                    bool sync_stream = false);
 
     // Construct from ID, actions and label
-    ActionTimes(AuxId, SPActionRegistry const&, std::string label);
+    ActionTimes(AuxId,
+                SPActionRegistry const&,
+                std::string label,
+                bool sync_stream = false);
 
     //!@{
     //! \name Aux interface
@@ -74,18 +89,77 @@ class ActionTimes : public AuxParamsInterface
     AuxId aux_id_;
     std::weak_ptr<ActionRegistry> action_reg_;
     std::string label_;
+    bool sync_stream_;
 };
 
 //---------------------------------------------------------------------------//
 /*!
- * Accumulated action times on each thread.
+ * Accumulate action times on each thread.
+ *
+ * Time is measured between consecutive calls to \c mark and \c record and
+ * attributed to the action passed to \c record . Call \c mark before the
+ * first action of each step and after any untimed work between actions.
  *
- * \todo Always report CPU times and add a second vector for device runs that
- * uses the CUDA event API to record GPU times.
+ * On host (or when synchronizing a device stream) each call reads the clock
+ * once. For asynchronous device timing, each call instead records a
+ * timestamped event on the stream. The events for a step are kept in a ring
+ * of \c num_pending_steps buffers and are accumulated when the buffer is
+ * reused, by which time the kernels have long since completed.
  */
-struct ActionTimesState : public AuxStateInterface
+class ActionTimesState final : public AuxStateInterface
 {
-    std::vector<double> accum_time;
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecDbl = std::vector<double>;
+    //!@}
+
+    //! Number of steps to buffer before reading back device timers
+    static constexpr size_type num_pending_steps = 4;
+
+  public:
+    // Construct for a memory space and stream
+    ActionTimesState(MemSpace m,
+                     StreamId sid,
+                     size_type num_actions,
+                     bool sync_stream);
+
+    // Start timing the next action
+    void mark();
+
+    // Accumulate the time since the last mark to an action
+    void record(ActionId aid);
+
+    // Finish a step, reading back device timers from a previous step
+    void end_step();
+
+    // Get the accumulated times, waiting for any pending device timers
+    VecDbl accum_time() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    //! Events recorded during a single step
+    struct PendingStep
+    {
+        std::vector<DeviceEvent> events;
+        std::vector<ActionId> actions;
+        size_type size{0};
+    };
+
+    StreamId stream_id_;
+    bool sync_stream_{false};
+    VecDbl accum_time_;
+
+    // Host timing
+    Clock::time_point last_mark_;
+
+    // Deferred device timing
+    std::vector<PendingStep> pending_;
+    size_type current_{0};
+
+    void push_event(ActionId aid);
+    static void accumulate(PendingStep const& step, VecDbl* times);
 };
 
 //---------------------------------------------------------------------------//
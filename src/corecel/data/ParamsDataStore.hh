@@ -11,8 +11,10 @@
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
 #include "corecel/sys/Device.hh"
+#include "corecel/sys/SetupProfiler.hh"
 
 #include "ParamsDataInterface.hh"
+#include "SharedHostParams.hh"
 
 namespace celeritas
 {
@@ -29,6 +31,9 @@ namespace celeritas
  * - Has a boolean operator returning whether it's in a valid state.
  *
  * On assignment, it will copy the data to the device if the GPU is enabled.
+ * The copy is recorded as a "params-to-device" setup phase. If \c
+ * shared_host_params is enabled, the host data is moved into memory shared
+ * with the other processes on the node.
  *
  * \par Example:
  * \code
@@ -66,7 +71,7 @@ class ParamsDataStore final : public ParamsDataInterface<P>
     explicit inline ParamsDataStore(HostValue&& host);
 
     //! Whether the data is assigned
-    explicit operator bool() const { return static_cast<bool>(host_); }
+    explicit operator bool() const { return static_cast<bool>(host_ref_); }
 
     //! Access data on host
     CELER_FORCEINLINE HostRef const& host_ref() const final
@@ -87,6 +92,7 @@ class ParamsDataStore final : public ParamsDataInterface<P>
     HostRef host_ref_;
     P<Ownership::value, MemSpace::device> device_;
     DeviceRef device_ref_;
+    SharedHostParams::SPConstSegment shared_;
 };
 
 //---------------------------------------------------------------------------//
@@ -103,7 +109,15 @@ ParamsDataStore<P>::ParamsDataStore(HostValue&& host) : host_(std::move(host))
         CELER_DEBUG_FAIL("incomplete host data or bad copy", precondition);
     }
 
-    host_ref_ = host_;
+    if (auto& share = celeritas::shared_host_params(); CELER_UNLIKELY(share))
+    {
+        // Reference the node-local shared copy of the host data
+        shared_ = share([this] { host_ref_ = host_; });
+    }
+    else
+    {
+        host_ref_ = host_;
+    }
 
     if (celeritas::device())
     {
@@ -114,9 +128,16 @@ ParamsDataStore<P>::ParamsDataStore(HostValue&& host) : host_(std::move(host))
         }
 
         // Copy data to device and save reference
+        ScopedSetupPhase record_phase{"params-to-device"};
         device_ = host_;
         device_ref_ = device_;
     }
+
+    if (shared_)
+    {
+        // Release the local copy
+        host_ = {};
+    }
 }
 
 //---------------------------------------------------------------------------//
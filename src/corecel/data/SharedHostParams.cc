@@ -0,0 +1,123 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/SharedHostParams.cc
+//---------------------------------------------------------------------------//
+#include "SharedHostParams.hh"
+
+#include <utility>
+#ifndef _WIN32
+#    include <unistd.h>
+#endif
+
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct disabled.
+ */
+SharedHostParams::SharedHostParams() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a node-local communicator.
+ *
+ * All processes in the communicator must be able to access the same POSIX
+ * shared memory: see \c comm_node . Segment names are unique to the job,
+ * based on the process ID of the lowest rank.
+ */
+SharedHostParams::SharedHostParams(MpiCommunicator const& comm)
+    : comm_{std::make_unique<MpiCommunicator const>(comm)}
+{
+#ifndef _WIN32
+    long pid = (comm.rank() == 0 ? static_cast<long>(getpid()) : 0);
+    pid = allreduce(comm, Operation::sum, pid);
+    prefix_ = "/celeritas-" + std::to_string(pid) + "-";
+#else
+    CELER_NOT_IMPLEMENTED("shared memory on Windows");
+#endif
+    CELER_LOG(debug) << "Sharing host params data across "
+                     << comm.size() << " process"
+                     << (comm.size() == 1 ? "" : "es");
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Default destructor and move
+SharedHostParams::~SharedHostParams() = default;
+SharedHostParams::SharedHostParams(SharedHostParams&&) noexcept = default;
+SharedHostParams&
+SharedHostParams::operator=(SharedHostParams&&) noexcept = default;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create the segment on the lowest rank and attach on the others.
+ *
+ * The result is null if the data are empty.
+ */
+std::shared_ptr<SharedMemorySegment>
+SharedHostParams::create_or_attach(std::size_t size)
+{
+    CELER_EXPECT(comm_);
+    auto const& comm = *comm_;
+
+    // Check that all processes constructed the same data
+    auto min_size = allreduce(comm, Operation::min, size);
+    auto max_size = allreduce(comm, Operation::max, size);
+    CELER_VALIDATE(min_size == max_size,
+                   << "cannot share host params data: processes on this "
+                      "node constructed different data (size "
+                   << min_size << " to " << max_size << " bytes)");
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    std::string name = prefix_ + std::to_string(num_segments_++);
+    std::shared_ptr<SharedMemorySegment> result;
+    if (comm.rank() == 0)
+    {
+        result = std::make_shared<SharedMemorySegment>(std::move(name), size);
+    }
+    barrier(comm);
+    if (comm.rank() != 0)
+    {
+        result = std::make_shared<SharedMemorySegment>(std::move(name));
+        CELER_VALIDATE(result->data().size() >= size,
+                       << "shared memory segment '" << result->name()
+                       << "' is smaller than expected");
+    }
+    num_bytes_ += size;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all processes to attach and remove the segment name.
+ */
+void SharedHostParams::finish(SharedMemorySegment& segment)
+{
+    barrier(*comm_);
+    segment.unlink();
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Global shared memory options for params data.
+ */
+SharedHostParams& shared_host_params()
+{
+    static SharedHostParams shp;
+    return shp;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,138 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/SharedHostParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/SharedMemorySegment.hh"
+
+#include "detail/CollectionRelocator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class MpiCommunicator;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Store immutable host params data in memory shared across a node.
+ *
+ * When multiple processes run on the same node, each one normally holds an
+ * identical copy of every params collection. When this class is enabled, the
+ * lowest rank of the node-local communicator copies the host data of each \c
+ * ParamsDataStore into a POSIX shared memory segment, and every process
+ * (including the lowest rank) references the shared copy and frees its own.
+ * Device data is unaffected.
+ *
+ * Every process must construct the same params in the same order, from a
+ * single thread, since each \c ParamsDataStore construction is a collective
+ * operation over the communicator. Mismatched sizes are detected and result in
+ * an error on all processes.
+ *
+ * The global instance returned by \c shared_host_params is disabled by
+ * default.
+ */
+class SharedHostParams
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstSegment = std::shared_ptr<SharedMemorySegment const>;
+    //!@}
+
+  public:
+    // Construct disabled
+    SharedHostParams();
+
+    // Construct with a node-local communicator
+    explicit SharedHostParams(MpiCommunicator const& comm);
+
+    // Default destructor and move
+    ~SharedHostParams();
+    SharedHostParams(SharedHostParams&&) noexcept;
+    SharedHostParams& operator=(SharedHostParams&&) noexcept;
+    SharedHostParams(SharedHostParams const&) = delete;
+    SharedHostParams& operator=(SharedHostParams const&) = delete;
+
+    //! Whether sharing is enabled
+    explicit operator bool() const { return static_cast<bool>(comm_); }
+
+    // Move the host data referenced by an assignment into shared memory
+    template<class F>
+    inline SPConstSegment operator()(F&& assign_host_ref);
+
+    //! Number of segments shared by this process
+    size_type num_segments() const { return num_segments_; }
+
+    //! Total number of bytes shared by this process
+    std::size_t num_bytes() const { return num_bytes_; }
+
+  private:
+    std::unique_ptr<MpiCommunicator const> comm_;
+    std::string prefix_;
+    size_type num_segments_{0};
+    std::size_t num_bytes_{0};
+
+    std::shared_ptr<SharedMemorySegment> create_or_attach(std::size_t size);
+    void finish(SharedMemorySegment& segment);
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Global shared memory options for params data
+SharedHostParams& shared_host_params();
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Move the host data referenced by an assignment into shared memory.
+ *
+ * The function argument must assign a host value to a host const reference.
+ * It is called twice: once to measure the size of all collections, and again
+ * to copy the data into (or point at) the shared segment. The returned segment
+ * must outlive the reference. If the data are empty, the reference points to
+ * the original data and the result is null.
+ */
+template<class F>
+auto SharedHostParams::operator()(F&& assign_host_ref) -> SPConstSegment
+{
+    CELER_EXPECT(*this);
+
+    detail::CollectionRelocator measure;
+    {
+        detail::ScopedCollectionRelocator scoped_relocate{&measure};
+        assign_host_ref();
+    }
+
+    auto segment = this->create_or_attach(measure.size());
+    if (!segment)
+    {
+        return segment;
+    }
+
+    using Mode = detail::CollectionRelocator::Mode;
+    detail::CollectionRelocator relocate{
+        segment->owner() ? Mode::write : Mode::attach, segment->data()};
+    {
+        detail::ScopedCollectionRelocator scoped_relocate{&relocate};
+        assign_host_ref();
+    }
+    CELER_ASSERT(relocate.size() == measure.size());
+
+    this->finish(*segment);
+    return segment;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
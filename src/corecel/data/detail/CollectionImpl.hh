@@ -22,6 +22,7 @@
 #include "corecel/data/PinnedAllocator.hh"
 #include "corecel/sys/Device.hh"
 
+#include "CollectionRelocator.hh"
 #ifdef CELER_DEVICE_COMPILE
 #    include "DisabledStorage.hh"
 #else
@@ -166,6 +167,9 @@ inline void validate_compatible_size(
  * Since the copy operation is done only on the default stream, this should
  * only be performed during setup and during testing. State allocations should
  * use a separate resize+copy.
+ *
+ * Host const references are redirected into shared memory while a \c
+ * CollectionRelocator is active.
  */
 template<class T, Ownership SW, MemSpace SM, Ownership DW, MemSpace DM>
 inline void copy_collection(
@@ -197,6 +201,19 @@ inline void copy_collection(
         }
         else
         {
+            if constexpr (DM == MemSpace::host
+                          && DW == Ownership::const_reference)
+            {
+                if (auto* relocate = active_collection_relocator();
+                    CELER_UNLIKELY(relocate))
+                {
+                    // Point to the relocated copy of the data
+                    void const* data = (*relocate)(
+                        src.data(), src.size() * sizeof(T), alignof(T));
+                    src = {static_cast<T*>(const_cast<void*>(data)),
+                           src.size()};
+                }
+            }
             // Make span in same memspace, prohibiting const violation
             *dst = DstStorageT{src.data(), src.size()};
         }
@@ -0,0 +1,109 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/CollectionRelocator.cc
+//---------------------------------------------------------------------------//
+#include "CollectionRelocator.hh"
+
+#include <cstring>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+thread_local CollectionRelocator* current_relocator{nullptr};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct to write to or attach to a buffer.
+ *
+ * In \c write mode the buffer must be writable: it is const here only so that
+ * both modes share an interface.
+ */
+CollectionRelocator::CollectionRelocator(Mode mode,
+                                         Span<std::byte const> buffer)
+    : mode_{mode}, buffer_{buffer}
+{
+    CELER_EXPECT(mode_ != Mode::measure);
+    CELER_EXPECT(!buffer_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the relocated address of the given data.
+ *
+ * Empty collections are not relocated.
+ */
+void const* CollectionRelocator::operator()(void const* data,
+                                            std::size_t size,
+                                            std::size_t align)
+{
+    CELER_EXPECT(align > 0 && (align & (align - 1)) == 0);
+    if (size == 0)
+    {
+        return data;
+    }
+
+    std::size_t start = (offset_ + align - 1) & ~(align - 1);
+    offset_ = start + size;
+    if (mode_ == Mode::measure)
+    {
+        return data;
+    }
+
+    CELER_VALIDATE(offset_ <= buffer_.size(),
+                   << "shared params data is inconsistent: collection at "
+                      "offset "
+                   << start << " with size " << size
+                   << " overflows the buffer size " << buffer_.size());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto* dst = const_cast<std::byte*>(buffer_.data()) + start;
+    if (mode_ == Mode::write)
+    {
+        std::memcpy(dst, data, size);
+    }
+    return dst;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Activate the relocator.
+ */
+ScopedCollectionRelocator::ScopedCollectionRelocator(
+    CollectionRelocator* relocate)
+    : prev_{current_relocator}
+{
+    CELER_EXPECT(relocate);
+    current_relocator = relocate;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the previous relocator.
+ */
+ScopedCollectionRelocator::~ScopedCollectionRelocator()
+{
+    current_relocator = prev_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Active relocator for the current thread (usually null).
+ */
+CollectionRelocator* active_collection_relocator()
+{
+    return current_relocator;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
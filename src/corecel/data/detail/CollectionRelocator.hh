@@ -0,0 +1,86 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/CollectionRelocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Redirect host const references into a contiguous external buffer.
+ *
+ * While a relocator is active on the current thread, assigning a host value
+ * collection to a host const reference collection calls it to obtain the
+ * referenced data. Collections are laid out sequentially with their natural
+ * alignment, so the same sequence of assignments always produces the same
+ * layout. The relocator can:
+ * - \c measure the buffer size needed, returning the original data;
+ * - \c write a copy of the data into the buffer; or
+ * - \c attach to a buffer already written by another process, returning a
+ *   pointer into the buffer without copying.
+ */
+class CollectionRelocator
+{
+  public:
+    enum class Mode
+    {
+        measure,
+        write,
+        attach
+    };
+
+  public:
+    // Construct to measure the buffer size
+    CollectionRelocator() = default;
+
+    // Construct to write to or attach to a buffer
+    CollectionRelocator(Mode mode, Span<std::byte const> buffer);
+
+    // Get the relocated address of the given data
+    void const* operator()(void const* data, std::size_t size, std::size_t align);
+
+    //! Number of bytes used
+    std::size_t size() const { return offset_; }
+
+  private:
+    Mode mode_{Mode::measure};
+    Span<std::byte const> buffer_;
+    std::size_t offset_{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Activate a relocator on the current thread for the lifetime of this object.
+ */
+class ScopedCollectionRelocator
+{
+  public:
+    // Activate the relocator
+    explicit ScopedCollectionRelocator(CollectionRelocator* relocate);
+
+    // Restore the previous relocator
+    ~ScopedCollectionRelocator();
+
+    CELER_DELETE_COPY_MOVE(ScopedCollectionRelocator);
+
+  private:
+    CollectionRelocator* prev_;
+};
+
+//---------------------------------------------------------------------------//
+// Active relocator for the current thread (usually null)
+CollectionRelocator* active_collection_relocator();
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,55 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryArchive.cc
+//---------------------------------------------------------------------------//
+#include "BinaryArchive.hh"
+
+#include <cstring>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a buffer to append to.
+ */
+BinaryWriter::BinaryWriter(std::string* buffer) : buffer_{buffer}
+{
+    CELER_EXPECT(buffer_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append raw bytes.
+ */
+void BinaryWriter::write_bytes(void const* data, std::size_t size)
+{
+    CELER_EXPECT(data || size == 0);
+    buffer_->append(static_cast<char const*>(data), size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with data to read.
+ */
+BinaryReader::BinaryReader(Span<std::byte const> data) : data_{data} {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy raw bytes.
+ */
+void BinaryReader::read_bytes(void* data, std::size_t size)
+{
+    CELER_VALIDATE(size <= this->remaining(),
+                   << "binary data is truncated: cannot read " << size
+                   << " bytes at offset " << pos_ << " of " << data_.size());
+    if (size > 0)
+    {
+        std::memcpy(data, data_.data() + pos_, size);
+    }
+    pos_ += size;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
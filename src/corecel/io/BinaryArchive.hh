@@ -0,0 +1,334 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryArchive.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "corecel/Assert.hh"
+#include "corecel/OpaqueId.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Quantity.hh"
+
+#include "detail/BinaryArchiveImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write data to a compact binary buffer.
+ *
+ * Arithmetic and enumeration values are stored with their native
+ * representation, so the output is only portable between machines with the
+ * same endianness and type sizes. Strings, vectors, maps, pairs, optionals,
+ * variants, fixed-size arrays, opaque IDs, and quantities are supported
+ * directly. Any other (non-empty) class must provide a free function, found
+ * by argument-dependent lookup, that lists its members:
+ * \code
+   template<class Archive>
+   void serialize(Archive& ar, Foo& foo)
+   {
+       ar(foo.bar, foo.baz);
+   }
+ * \endcode
+ * The same function is used by \c BinaryReader . Classes that can only be
+ * constructed from a converted value can check \c Archive::is_loading .
+ *
+ * \note The writer never modifies the values passed to \c serialize .
+ */
+class BinaryWriter
+{
+  public:
+    //! Whether this archive loads data
+    static constexpr bool is_loading = false;
+
+  public:
+    // Construct with a buffer to append to
+    explicit BinaryWriter(std::string* buffer);
+
+    //! Write one or more values
+    template<class... Ts>
+    void operator()(Ts const&... values)
+    {
+        (this->write(values), ...);
+    }
+
+    // Append raw bytes
+    void write_bytes(void const* data, std::size_t size);
+
+  private:
+    std::string* buffer_;
+
+    template<class T>
+    inline void write(T const& value);
+    inline void write_size(std::size_t size);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read data from a binary buffer created by \c BinaryWriter .
+ *
+ * The data must outlive the reader. Reading past the end of the buffer throws
+ * a \c RuntimeError .
+ */
+class BinaryReader
+{
+  public:
+    //! Whether this archive loads data
+    static constexpr bool is_loading = true;
+
+  public:
+    // Construct with data to read
+    explicit BinaryReader(Span<std::byte const> data);
+
+    //! Read one or more values
+    template<class... Ts>
+    void operator()(Ts&... values)
+    {
+        (this->read(values), ...);
+    }
+
+    // Copy raw bytes
+    void read_bytes(void* data, std::size_t size);
+
+    //! Number of bytes not yet read
+    std::size_t remaining() const { return data_.size() - pos_; }
+
+  private:
+    Span<std::byte const> data_;
+    std::size_t pos_{0};
+
+    template<class T>
+    inline void read(T& value);
+    inline std::size_t read_size();
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Write a single value.
+ */
+template<class T>
+void BinaryWriter::write(T const& value)
+{
+    if constexpr (detail::is_raw_binary_v<T> || std::is_same_v<T, bool>)
+    {
+        this->write_bytes(&value, sizeof(T));
+    }
+    else if constexpr (is_opaque_id_v<T>)
+    {
+        this->write(*value);
+    }
+    else if constexpr (is_quantity_v<T>)
+    {
+        this->write(value.value());
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        this->write_size(value.size());
+        this->write_bytes(value.data(), value.size());
+    }
+    else if constexpr (detail::IsVector<T>::value)
+    {
+        using value_type = typename T::value_type;
+        this->write_size(value.size());
+        if constexpr (detail::is_raw_binary_v<value_type>)
+        {
+            this->write_bytes(value.data(), value.size() * sizeof(value_type));
+        }
+        else
+        {
+            for (value_type const& v : value)
+            {
+                this->write(v);
+            }
+        }
+    }
+    else if constexpr (detail::IsMap<T>::value)
+    {
+        this->write_size(value.size());
+        for (auto const& [k, v] : value)
+        {
+            this->write(k);
+            this->write(v);
+        }
+    }
+    else if constexpr (detail::IsPair<T>::value)
+    {
+        this->write(value.first);
+        this->write(value.second);
+    }
+    else if constexpr (detail::IsOptional<T>::value)
+    {
+        this->write(value.has_value());
+        if (value)
+        {
+            this->write(*value);
+        }
+    }
+    else if constexpr (detail::IsVariant<T>::value)
+    {
+        CELER_VALIDATE(!value.valueless_by_exception(),
+                       << "cannot write a valueless variant");
+        this->write(static_cast<std::uint32_t>(value.index()));
+        std::visit([this](auto const& v) { this->write(v); }, value);
+    }
+    else if constexpr (detail::IsFixedArray<T>::value)
+    {
+        for (auto const& v : value)
+        {
+            this->write(v);
+        }
+    }
+    else if constexpr (std::is_empty_v<T>)
+    {
+        // Nothing to write
+    }
+    else
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        serialize(*this, const_cast<T&>(value));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the size of a container.
+ */
+void BinaryWriter::write_size(std::size_t size)
+{
+    this->write(static_cast<std::uint64_t>(size));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a single value.
+ */
+template<class T>
+void BinaryReader::read(T& value)
+{
+    if constexpr (detail::is_raw_binary_v<T> || std::is_same_v<T, bool>)
+    {
+        this->read_bytes(&value, sizeof(T));
+    }
+    else if constexpr (is_opaque_id_v<T>)
+    {
+        typename T::value_type v;
+        this->read(v);
+        value = T{v};
+    }
+    else if constexpr (is_quantity_v<T>)
+    {
+        typename T::value_type v;
+        this->read(v);
+        value = T{v};
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        value.resize(this->read_size());
+        this->read_bytes(value.data(), value.size());
+    }
+    else if constexpr (detail::IsVector<T>::value)
+    {
+        using value_type = typename T::value_type;
+        std::size_t size = this->read_size();
+        if constexpr (detail::is_raw_binary_v<value_type>)
+        {
+            CELER_VALIDATE(size <= this->remaining() / sizeof(value_type),
+                           << "binary data is truncated");
+            value.resize(size);
+            this->read_bytes(value.data(), size * sizeof(value_type));
+        }
+        else
+        {
+            value.clear();
+            value.reserve(size);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                value_type v{};
+                this->read(v);
+                value.push_back(std::move(v));
+            }
+        }
+    }
+    else if constexpr (detail::IsMap<T>::value)
+    {
+        std::size_t size = this->read_size();
+        value.clear();
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            typename T::key_type k{};
+            typename T::mapped_type v{};
+            this->read(k);
+            this->read(v);
+            value.emplace_hint(value.end(), std::move(k), std::move(v));
+        }
+    }
+    else if constexpr (detail::IsPair<T>::value)
+    {
+        this->read(value.first);
+        this->read(value.second);
+    }
+    else if constexpr (detail::IsOptional<T>::value)
+    {
+        bool has_value{};
+        this->read(has_value);
+        if (has_value)
+        {
+            this->read(value.emplace());
+        }
+        else
+        {
+            value.reset();
+        }
+    }
+    else if constexpr (detail::IsVariant<T>::value)
+    {
+        std::uint32_t index{};
+        this->read(index);
+        CELER_VALIDATE(index < std::variant_size_v<T>,
+                       << "invalid variant index " << index
+                       << " in binary data");
+        detail::emplace_variant(
+            value, index, std::make_index_sequence<std::variant_size_v<T>>{});
+        std::visit([this](auto& v) { this->read(v); }, value);
+    }
+    else if constexpr (detail::IsFixedArray<T>::value)
+    {
+        for (auto& v : value)
+        {
+            this->read(v);
+        }
+    }
+    else if constexpr (std::is_empty_v<T>)
+    {
+        // Nothing to read
+    }
+    else
+    {
+        serialize(*this, value);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the size of a container.
+ */
+std::size_t BinaryReader::read_size()
+{
+    std::uint64_t size{};
+    this->read(size);
+    return static_cast<std::size_t>(size);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,236 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryFile.cc
+//---------------------------------------------------------------------------//
+#include "BinaryFile.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+
+#include "corecel/Assert.hh"
+#include "corecel/io/StreamUtils.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/Version.hh"
+
+#include "BinaryArchive.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! File signature
+constexpr char magic[] = {'C', 'E', 'L', 'E', 'R', 'B', 'I', 'N'};
+
+//! Version of the header layout
+constexpr std::uint32_t format_version = 1;
+
+//---------------------------------------------------------------------------//
+//! Checksum of the payload
+std::uint64_t calc_checksum(Span<std::byte const> data)
+{
+    return hash_as_bytes(data);
+}
+
+//---------------------------------------------------------------------------//
+//! Unique suffix for a temporary file
+std::string temp_suffix()
+{
+#ifndef _WIN32
+    return "." + std::to_string(getpid()) + ".tmp";
+#else
+    return ".tmp";
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file and validate its header against the key.
+ */
+MappedBinaryFile::MappedBinaryFile(std::string const& filename,
+                                   BinaryFileKey const& key)
+{
+    CELER_EXPECT(!filename.empty());
+
+    Span<std::byte const> contents = this->map(filename);
+    if (contents.empty())
+    {
+        reason_ = "file is missing or empty";
+        return;
+    }
+
+    try
+    {
+        BinaryReader read{contents};
+
+        char file_magic[sizeof(magic)];
+        read.read_bytes(file_magic, sizeof(file_magic));
+        if (std::memcmp(file_magic, magic, sizeof(magic)) != 0)
+        {
+            reason_ = "not a Celeritas binary file";
+            return;
+        }
+
+        std::uint32_t version{};
+        std::string celer_version_str;
+        std::string label;
+        std::uint64_t hash{};
+        std::uint64_t size{};
+        std::uint64_t checksum{};
+        read(version, celer_version_str, label, hash, size, checksum);
+
+        if (version != format_version)
+        {
+            reason_ = "unsupported file format version "
+                      + std::to_string(version);
+        }
+        else if (celer_version_str != stream_to_string(celer_version()))
+        {
+            reason_ = "file was written by Celeritas " + celer_version_str;
+        }
+        else if (label != key.label)
+        {
+            reason_ = "file contains '" + label + "' data";
+        }
+        else if (hash != key.hash)
+        {
+            reason_ = "input has changed";
+        }
+        else if (size != read.remaining())
+        {
+            reason_ = "file is truncated";
+        }
+        else
+        {
+            payload_ = contents.subspan(contents.size() - size);
+            if (calc_checksum(payload_) != checksum)
+            {
+                reason_ = "checksum does not match";
+            }
+        }
+    }
+    catch (RuntimeError const& e)
+    {
+        reason_ = e.details().what;
+    }
+
+    if (!reason_.empty())
+    {
+        payload_ = {};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap the file.
+ */
+MappedBinaryFile::~MappedBinaryFile()
+{
+#ifndef _WIN32
+    if (addr_)
+    {
+        munmap(addr_, size_);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file contents read-only, or read them if mapping is unavailable.
+ */
+Span<std::byte const> MappedBinaryFile::map(std::string const& filename)
+{
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return {};
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        size_ = static_cast<std::size_t>(st.st_size);
+        void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED)
+        {
+            addr_ = addr;
+        }
+    }
+    close(fd);
+    if (addr_)
+    {
+        return {static_cast<std::byte const*>(addr_), size_};
+    }
+#endif
+    std::ifstream infile(filename,
+                         std::ios::in | std::ios::binary | std::ios::ate);
+    if (!infile)
+    {
+        return {};
+    }
+    buffer_.resize(static_cast<std::size_t>(infile.tellg()));
+    infile.seekg(0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    infile.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size());
+    return {buffer_.data(), buffer_.size()};
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Atomically write a payload to a binary file with a header and checksum.
+ *
+ * The data is written to a temporary file which is then renamed, so that
+ * concurrent jobs never see a partially written file.
+ */
+void write_binary_file(std::string const& filename,
+                       BinaryFileKey const& key,
+                       std::string_view payload)
+{
+    CELER_EXPECT(!filename.empty());
+    CELER_EXPECT(!key.label.empty());
+
+    std::string header;
+    BinaryWriter write{&header};
+    write.write_bytes(magic, sizeof(magic));
+    write(format_version,
+          stream_to_string(celer_version()),
+          key.label,
+          key.hash,
+          static_cast<std::uint64_t>(payload.size()),
+          calc_checksum(
+              {reinterpret_cast<std::byte const*>(payload.data()),
+               payload.size()}));
+
+    std::string temp_filename = filename + temp_suffix();
+    {
+        std::ofstream outfile(temp_filename,
+                              std::ios::out | std::ios::binary);
+        CELER_VALIDATE(outfile,
+                       << "failed to open binary file at '" << temp_filename
+                       << "' for writing");
+        outfile.write(header.data(), header.size());
+        outfile.write(payload.data(), payload.size());
+        CELER_VALIDATE(outfile,
+                       << "failed to write binary file at '" << temp_filename
+                       << "'");
+    }
+    CELER_VALIDATE(std::rename(temp_filename.c_str(), filename.c_str()) == 0,
+                   << "failed to move binary file to '" << filename << "'");
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
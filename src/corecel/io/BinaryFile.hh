@@ -0,0 +1,92 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryFile.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Identify the contents of a cached binary file.
+ *
+ * The label describes the kind of data stored, and the hash should combine
+ * every input used to generate it. Files written by a different version of
+ * Celeritas are never reused.
+ */
+struct BinaryFileKey
+{
+    std::string label;
+    std::uint64_t hash{};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Memory-map a binary file and validate its header.
+ *
+ * The file contents are accessible as long as this object is alive. If the
+ * file is missing, has a different key, was written by a different version of
+ * Celeritas, or fails its checksum, the result evaluates to \c false and \c
+ * reason describes why: callers should regenerate the data.
+ *
+ * \code
+   MappedBinaryFile cached{filename, key};
+   if (cached)
+   {
+       BinaryReader read{cached.payload()};
+       read(result);
+   }
+ * \endcode
+ */
+class MappedBinaryFile
+{
+  public:
+    // Map the file and validate its header against the key
+    MappedBinaryFile(std::string const& filename, BinaryFileKey const& key);
+
+    // Unmap the file
+    ~MappedBinaryFile();
+
+    CELER_DELETE_COPY_MOVE(MappedBinaryFile);
+
+    //! Whether the file is valid for the given key
+    explicit operator bool() const { return reason_.empty(); }
+
+    //! Payload data
+    Span<std::byte const> payload() const { return payload_; }
+
+    //! Reason the file is unusable (empty if valid)
+    std::string const& reason() const { return reason_; }
+
+  private:
+    void* addr_{nullptr};
+    std::size_t size_{0};
+    std::vector<std::byte> buffer_;
+    Span<std::byte const> payload_;
+    std::string reason_;
+
+    Span<std::byte const> map(std::string const& filename);
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Atomically write a payload to a binary file with a header and checksum
+void write_binary_file(std::string const& filename,
+                       BinaryFileKey const& key,
+                       std::string_view payload);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
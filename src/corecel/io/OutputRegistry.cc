@@ -21,6 +21,8 @@
 #include "corecel/sys/EnvironmentIO.json.hh"  // IWYU pragma: keep
 #include "corecel/sys/KernelRegistry.hh"
 #include "corecel/sys/KernelRegistryIO.json.hh"  // IWYU pragma: keep
+#include "corecel/sys/SetupProfiler.hh"
+#include "corecel/sys/SetupProfilerIO.json.hh"  // IWYU pragma: keep
 
 #include "BuildOutput.hh"
 #include "JsonPimpl.hh"
@@ -130,6 +132,10 @@ void insert_system_diagnostics(OutputRegistry& output_reg)
         celeritas::kernel_registry()));
     output_reg.insert(OutputInterfaceAdapter<Environment>::from_const_ref(
         OutputInterface::Category::system, "environ", celeritas::environment()));
+    output_reg.insert(OutputInterfaceAdapter<SetupProfiler>::from_const_ref(
+        OutputInterface::Category::system,
+        "setup",
+        celeritas::setup_profiler()));
     output_reg.insert(std::make_shared<BuildOutput>());
     if (CELERITAS_USE_OPENMP)
     {
@@ -0,0 +1,112 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/detail/BinaryArchiveImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/EnumArray.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Values that are stored directly as their in-memory representation
+template<class T>
+inline constexpr bool is_raw_binary_v
+    = (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+      && !std::is_same_v<T, bool>;
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Detect container types with built-in binary serialization
+template<class T>
+struct IsVector : std::false_type
+{
+};
+template<class T, class A>
+struct IsVector<std::vector<T, A>> : std::true_type
+{
+};
+
+template<class T>
+struct IsMap : std::false_type
+{
+};
+template<class K, class V, class C, class A>
+struct IsMap<std::map<K, V, C, A>> : std::true_type
+{
+};
+
+template<class T>
+struct IsPair : std::false_type
+{
+};
+template<class T, class U>
+struct IsPair<std::pair<T, U>> : std::true_type
+{
+};
+
+template<class T>
+struct IsOptional : std::false_type
+{
+};
+template<class T>
+struct IsOptional<std::optional<T>> : std::true_type
+{
+};
+
+template<class T>
+struct IsVariant : std::false_type
+{
+};
+template<class... Ts>
+struct IsVariant<std::variant<Ts...>> : std::true_type
+{
+};
+
+template<class T>
+struct IsFixedArray : std::false_type
+{
+};
+template<class T, std::size_t N>
+struct IsFixedArray<Array<T, N>> : std::true_type
+{
+};
+template<class T, std::size_t N>
+struct IsFixedArray<std::array<T, N>> : std::true_type
+{
+};
+template<class E, class T>
+struct IsFixedArray<EnumArray<E, T>> : std::true_type
+{
+};
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Default-construct the variant alternative with the given runtime index.
+ */
+template<class V, std::size_t... Is>
+void emplace_variant(V& value, std::size_t index, std::index_sequence<Is...>)
+{
+    ((index == Is ? static_cast<void>(value.template emplace<Is>())
+                  : static_cast<void>(0)),
+     ...);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -14,6 +14,7 @@
 #include "corecel/data/Ref.hh"
 #include "corecel/random/data/RanluxppTypes.hh"
 #include "corecel/random/data/detail/RanluxppRngStateInit.hh"
+#include "corecel/sys/SetupProfiler.hh"
 
 namespace celeritas
 {
@@ -33,6 +34,8 @@ void resize(RanluxppRngStateData<Ownership::value, M>* state,
     CELER_EXPECT(size > 0);
     CELER_EXPECT(M == MemSpace::host || celeritas::device());
 
+    ScopedSetupPhase record_phase{"init-rng"};
+
     // Create a temporary "native" copy of the params so that we can initialize
     // the ranlux state
     RanluxppRngParamsData<Ownership::value, M> p;
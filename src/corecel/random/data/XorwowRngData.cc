@@ -12,7 +12,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 
 namespace celeritas
 {
@@ -69,7 +69,7 @@ void resize(XorwowRngStateData<Ownership::value, M>* state,
     CELER_EXPECT(size > 0);
     CELER_EXPECT(params);
 
-    ScopedProfiling profile_this{"init-rng"};
+    ScopedSetupPhase record_phase{"init-rng"};
 
     // Create seeds for device in host memory
     HostVal<XorwowRngStateData> host_state;
@@ -58,15 +58,29 @@ void DeviceEvent::ImplDeleter::operator()(Impl* impl) noexcept
 /*!
  * Construct a device event.
  */
-DeviceEvent::DeviceEvent(Device const& d)
+DeviceEvent::DeviceEvent(Device const& d) : DeviceEvent{d, false} {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a device event, optionally recording timestamps.
+ *
+ * Timing adds a small cost to recording the event, so it should only be
+ * enabled for events used with \c elapsed_since .
+ */
+DeviceEvent::DeviceEvent(Device const& d, bool enable_timing)
 {
     if (d)
     {
         EventT event;
         CELER_DEVICE_API_CALL(EventCreateWithFlags(
-            &event, CELER_DEVICE_API_SYMBOL(EventDisableTiming)));
+            &event,
+            enable_timing ? CELER_DEVICE_API_SYMBOL(EventDefault)
+                          : CELER_DEVICE_API_SYMBOL(EventDisableTiming)));
         impl_.reset(new Impl{event});
     }
+#if !CELER_USE_DEVICE
+    CELER_DISCARD(enable_timing);
+#endif
     CELER_ENSURE(static_cast<bool>(*this) == static_cast<bool>(d));
 }
 
@@ -161,5 +175,26 @@ void DeviceEvent::sync() const
     CELER_DEVICE_API_CALL(EventSynchronize(impl_->event));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the device time elapsed between a previous event and this one.
+ *
+ * Both events must have been constructed with timing enabled and recorded,
+ * and this event must be complete (see \c ready ). The result is in seconds
+ * and has a resolution of about a microsecond.
+ */
+double DeviceEvent::elapsed_since(DeviceEvent const& start) const
+{
+    CELER_EXPECT(*this && start);
+
+    float milliseconds{0};
+    CELER_DEVICE_API_CALL(
+        EventElapsedTime(&milliseconds, start.impl_->event, impl_->event));
+#if !CELER_USE_DEVICE
+    CELER_DISCARD(start);
+#endif
+    return static_cast<double>(milliseconds) * 1e-3;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
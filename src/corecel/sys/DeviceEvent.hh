@@ -57,6 +57,10 @@ class Stream;
  * \endcode
  * Use \c my_kernel.sync() before the kernel launch to wait on the previous
  * kernel launch before going again.
+ *
+ * Events are created without timing data unless constructed with \c
+ * enable_timing , in which case \c elapsed_since can be used to measure the
+ * device time between two recorded events without synchronizing the stream.
  */
 class DeviceEvent
 {
@@ -75,6 +79,8 @@ class DeviceEvent
   public:
     // Construct with a device context
     explicit DeviceEvent(Device const& d);
+    // Construct with a device context, optionally recording timestamps
+    DeviceEvent(Device const& d, bool enable_timing);
     // Construct a null event
     DeviceEvent(std::nullptr_t);
     CELER_DEFAULT_MOVE_DELETE_COPY(DeviceEvent);
@@ -98,6 +104,9 @@ class DeviceEvent
     // Block the host until the recorded event is complete
     void sync() const;
 
+    // Device time [s] elapsed between a previous event and this one
+    double elapsed_since(DeviceEvent const& start) const;
+
   private:
     struct Impl;
     struct ImplDeleter
@@ -26,6 +26,30 @@ MpiCommunicator& global_comm_world()
     return comm;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Split the world communicator into processes that can share memory.
+ */
+MpiCommunicator make_comm_node()
+{
+    auto const& world = comm_world();
+    if (!world)
+    {
+        return {};
+    }
+#if CELERITAS_USE_MPI
+    MPI_Comm node_comm;
+    CELER_MPI_CALL(MPI_Comm_split_type(world.mpi_comm(),
+                                       MPI_COMM_TYPE_SHARED,
+                                       world.rank(),
+                                       MPI_INFO_NULL,
+                                       &node_comm));
+    return MpiCommunicator{node_comm};
+#else
+    CELER_ASSERT_UNREACHABLE();
+#endif
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -72,5 +96,18 @@ MpiCommunicator const& comm_world()
     return global_comm_world();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Shared communicator for processes on the same node.
+ *
+ * This is a null communicator if MPI is disabled. The communicator is created
+ * on first use, which is a collective operation over \c comm_world.
+ */
+MpiCommunicator const& comm_node()
+{
+    static MpiCommunicator comm{make_comm_node()};
+    return comm;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -80,6 +80,9 @@ class MpiCommunicator
 // Shared "world" Celeritas communicator
 MpiCommunicator const& comm_world();
 
+// Shared communicator for processes on the same node
+MpiCommunicator const& comm_node();
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
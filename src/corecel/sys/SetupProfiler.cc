@@ -0,0 +1,208 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SetupProfiler.cc
+//---------------------------------------------------------------------------//
+#include "SetupProfiler.hh"
+
+#include <fstream>
+#include <unordered_map>
+#include <utility>
+
+#include "corecel/Config.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/DeviceRuntimeApi.hh"
+
+#include "Device.hh"
+
+#ifndef _WIN32
+#    include <unistd.h>
+#    include <sys/resource.h>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Innermost active phase of each profiler on the current thread
+thread_local std::unordered_map<SetupProfiler const*, SetupPhaseId>
+    current_phases;
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start a new phase and return its ID.
+ */
+SetupPhaseId SetupProfiler::push(std::string_view label, SetupPhaseId parent)
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    CELER_EXPECT(!parent || parent < phases_.size());
+
+    SetupPhaseId result(phases_.size());
+    SetupPhase phase;
+    phase.label = label;
+    phase.parent = parent;
+    phases_.push_back(std::move(phase));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish a phase.
+ *
+ * The label and parent of the result are ignored.
+ */
+void SetupProfiler::pop(SetupPhaseId id, SetupPhase const& result)
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    CELER_EXPECT(id < phases_.size());
+
+    SetupPhase& phase = phases_[id.unchecked_get()];
+    phase.time = result.time;
+    phase.host_delta = result.host_delta;
+    phase.host_peak = result.host_peak;
+    phase.device_delta = result.device_delta;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of recorded phases.
+ */
+SetupPhaseId::size_type SetupProfiler::size() const
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    return phases_.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy all recorded phases.
+ */
+std::vector<SetupPhase> SetupProfiler::phases() const
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    return phases_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start the phase with the global profiler.
+ */
+ScopedSetupPhase::ScopedSetupPhase(std::string_view label)
+    : ScopedSetupPhase{label, &setup_profiler()}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start the phase with the given profiler.
+ */
+ScopedSetupPhase::ScopedSetupPhase(std::string_view label,
+                                   SetupProfiler* profiler)
+    : profile_{label}, profiler_{profiler}, start_mem_{get_memory_usage()}
+{
+    CELER_EXPECT(profiler_);
+    SetupPhaseId& current = current_phases[profiler_];
+    parent_ = current;
+    id_ = profiler_->push(label, parent_);
+    current = id_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the elapsed time and memory change.
+ */
+ScopedSetupPhase::~ScopedSetupPhase()
+{
+    SetupPhase result;
+    result.time = get_time_();
+
+    MemoryUsage stop_mem = get_memory_usage();
+    result.host_delta = stop_mem.host_resident - start_mem_.host_resident;
+    result.host_peak = stop_mem.host_peak;
+    result.device_delta = stop_mem.device_used - start_mem_.device_used;
+
+    profiler_->pop(id_, result);
+    if (parent_)
+    {
+        current_phases[profiler_] = parent_;
+    }
+    else
+    {
+        current_phases.erase(profiler_);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Globally shared record of setup phases.
+ */
+SetupProfiler& setup_profiler()
+{
+    static SetupProfiler sp;
+    return sp;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Measure the current process memory usage.
+ *
+ * The current resident set size is only available on Linux. Failures are
+ * silently ignored so that this can be called from destructors.
+ */
+MemoryUsage get_memory_usage()
+{
+    MemoryUsage result;
+
+#ifndef _WIN32
+    {
+        // Second entry is the number of resident pages
+        std::ifstream statm("/proc/self/statm");
+        long size{0};
+        long resident{0};
+        if (statm >> size >> resident)
+        {
+            result.host_resident = static_cast<MemoryUsage::value_type>(
+                resident * sysconf(_SC_PAGESIZE));
+        }
+    }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#    ifdef __APPLE__
+        // Reported in bytes
+        result.host_peak = usage.ru_maxrss;
+#    else
+        // Reported in kilobytes
+        result.host_peak = usage.ru_maxrss * 1024;
+#    endif
+    }
+#endif
+
+#if CELER_USE_DEVICE
+    if (celeritas::device())
+    {
+        std::size_t free{0};
+        std::size_t total{0};
+        if (CELER_DEVICE_API_SYMBOL(MemGetInfo)(&free, &total)
+            == CELER_DEVICE_API_SYMBOL(Success))
+        {
+            result.device_used
+                = static_cast<MemoryUsage::value_type>(total - free);
+        }
+    }
+#endif
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
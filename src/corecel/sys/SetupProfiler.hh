@@ -0,0 +1,142 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SetupProfiler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/OpaqueId.hh"
+
+#include "ScopedProfiling.hh"
+#include "Stopwatch.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Process memory usage at a point in time.
+ *
+ * All values are in bytes. Host values are zero if the platform does not
+ * provide them, and device values are zero if no device is active.
+ */
+struct MemoryUsage
+{
+    using value_type = std::int64_t;
+
+    value_type host_resident{0};  //!< Current resident set size
+    value_type host_peak{0};  //!< High water mark of resident set size
+    value_type device_used{0};  //!< Memory in use on the active device
+};
+
+//---------------------------------------------------------------------------//
+//! Result of a single setup phase
+struct SetupPhase
+{
+    using value_type = MemoryUsage::value_type;
+
+    std::string label;
+    OpaqueId<SetupPhase> parent;  //!< Enclosing phase
+    double time{0};  //!< Wall time [s]
+    value_type host_delta{0};  //!< Change in resident set size
+    value_type host_peak{0};  //!< Resident high water mark at end of phase
+    value_type device_delta{0};  //!< Change in device memory usage
+};
+
+//! Ordered identifiers for setup phases
+using SetupPhaseId = OpaqueId<SetupPhase>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the time and memory spent in nested setup phases.
+ *
+ * Phases are added in the order they \em start, so that parents always
+ * precede their children. The nesting is tracked per thread and per profiler
+ * by \c ScopedSetupPhase . Results are written to the output registry as the
+ * "setup" system diagnostic.
+ */
+class SetupProfiler
+{
+  public:
+    // Construct without any data
+    SetupProfiler() = default;
+
+    //// CONSTRUCTION ////
+
+    // Start a new phase and return its ID
+    SetupPhaseId push(std::string_view label, SetupPhaseId parent);
+
+    // Finish a phase
+    void pop(SetupPhaseId id, SetupPhase const& result);
+
+    //// ACCESSORS ////
+
+    // Number of recorded phases
+    SetupPhaseId::size_type size() const;
+
+    // Copy all recorded phases
+    std::vector<SetupPhase> phases() const;
+
+  private:
+    mutable std::mutex mutex_;
+    std::vector<SetupPhase> phases_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time, measure, and annotate a phase of problem setup.
+ *
+ * This combines a \c ScopedProfiling range with a wall-clock timer and a
+ * memory usage snapshot. Phases constructed inside the scope of another phase
+ * on the same thread are recorded as its children.
+ *
+ * \code
+   void build_physics()
+   {
+       ScopedSetupPhase record_phase{"physics"};
+       // ...
+   }
+ * \endcode
+ */
+class ScopedSetupPhase
+{
+  public:
+    // Start the phase with the global profiler
+    explicit ScopedSetupPhase(std::string_view label);
+
+    // Start the phase with the given profiler
+    ScopedSetupPhase(std::string_view label, SetupProfiler* profiler);
+
+    // Record the phase
+    ~ScopedSetupPhase();
+
+    CELER_DELETE_COPY_MOVE(ScopedSetupPhase);
+
+  private:
+    ScopedProfiling profile_;
+    SetupProfiler* profiler_;
+    SetupPhaseId id_;
+    SetupPhaseId parent_;
+    MemoryUsage start_mem_;
+    Stopwatch get_time_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Globally shared record of setup phases
+SetupProfiler& setup_profiler();
+
+// Measure the current process memory usage
+MemoryUsage get_memory_usage();
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,48 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SetupProfilerIO.json.cc
+//---------------------------------------------------------------------------//
+#include "SetupProfilerIO.json.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write one setup phase to JSON.
+ *
+ * Times are in seconds and memory is in bytes. The parent is the index of the
+ * enclosing phase, or null for a top-level phase.
+ */
+void to_json(nlohmann::json& j, SetupPhase const& phase)
+{
+    j = {
+        {"label", phase.label},
+        {"parent", nullptr},
+        {"time", phase.time},
+        {"host_delta", phase.host_delta},
+        {"host_peak", phase.host_peak},
+        {"device_delta", phase.device_delta},
+    };
+    if (phase.parent)
+    {
+        j["parent"] = phase.parent.unchecked_get();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all setup phases to JSON in the order they started.
+ */
+void to_json(nlohmann::json& j, SetupProfiler const& profiler)
+{
+    j = nlohmann::json::array();
+    for (auto const& phase : profiler.phases())
+    {
+        j.push_back(phase);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
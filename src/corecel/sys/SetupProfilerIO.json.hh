@@ -0,0 +1,23 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SetupProfilerIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "SetupProfiler.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+
+// Write one setup phase to JSON
+void to_json(nlohmann::json& j, SetupPhase const& phase);
+// Write all setup phases to JSON
+void to_json(nlohmann::json& j, SetupProfiler const& profiler);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,141 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SharedMemorySegment.cc
+//---------------------------------------------------------------------------//
+#include "SharedMemorySegment.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Create a writable segment.
+ *
+ * The name must start with a slash and contain no other slashes. An existing
+ * segment with the same name (e.g., left over from a crashed job) is an error.
+ */
+SharedMemorySegment::SharedMemorySegment(std::string name, std::size_t size)
+    : name_{std::move(name)}, size_{size}, owner_{true}
+{
+    CELER_EXPECT(name_.size() > 1 && name_.front() == '/');
+    CELER_EXPECT(size_ > 0);
+
+#ifndef _WIN32
+    int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    CELER_VALIDATE(fd >= 0,
+                   << "failed to create shared memory segment '" << name_
+                   << "': " << std::strerror(errno));
+    linked_ = true;
+    int err = ftruncate(fd, static_cast<off_t>(size_));
+    void* addr = MAP_FAILED;
+    if (err == 0)
+    {
+        addr = mmap(
+            nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    int mmap_errno = errno;
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        this->unlink();
+        CELER_VALIDATE(false,
+                       << "failed to allocate " << size_
+                       << " bytes in shared memory segment '" << name_
+                       << "': " << std::strerror(mmap_errno));
+    }
+    addr_ = static_cast<std::byte*>(addr);
+#else
+    CELER_NOT_IMPLEMENTED("shared memory on Windows");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Attach read-only to an existing segment.
+ */
+SharedMemorySegment::SharedMemorySegment(std::string name)
+    : name_{std::move(name)}
+{
+    CELER_EXPECT(name_.size() > 1 && name_.front() == '/');
+
+#ifndef _WIN32
+    int fd = shm_open(name_.c_str(), O_RDONLY, 0);
+    CELER_VALIDATE(fd >= 0,
+                   << "failed to attach to shared memory segment '" << name_
+                   << "': " << std::strerror(errno));
+    struct stat st;
+    void* addr = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        size_ = static_cast<std::size_t>(st.st_size);
+        addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    int mmap_errno = errno;
+    close(fd);
+    CELER_VALIDATE(addr != MAP_FAILED,
+                   << "failed to map shared memory segment '" << name_
+                   << "': " << std::strerror(mmap_errno));
+    addr_ = static_cast<std::byte*>(addr);
+#else
+    CELER_NOT_IMPLEMENTED("shared memory on Windows");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap and (if owner) unlink.
+ */
+SharedMemorySegment::~SharedMemorySegment()
+{
+#ifndef _WIN32
+    if (addr_)
+    {
+        munmap(addr_, size_);
+    }
+#endif
+    this->unlink();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Writable segment contents (owner only).
+ */
+Span<std::byte> SharedMemorySegment::mutable_data()
+{
+    CELER_EXPECT(owner_);
+    return {addr_, size_};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove the name so that no further processes can attach.
+ *
+ * This has no effect for processes that did not create the segment, or if the
+ * segment has already been unlinked.
+ */
+void SharedMemorySegment::unlink()
+{
+#ifndef _WIN32
+    if (owner_ && linked_)
+    {
+        shm_unlink(name_.c_str());
+        linked_ = false;
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
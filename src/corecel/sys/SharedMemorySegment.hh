@@ -0,0 +1,82 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SharedMemorySegment.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Map a named POSIX shared memory segment.
+ *
+ * One process \em creates the segment with a given size and writes to it;
+ * other processes on the same node \em attach to it by name with read-only
+ * access. The creating process removes the name when \c unlink is called or
+ * when it is destroyed: processes that have already attached keep their
+ * mapping.
+ *
+ * \code
+   // Owning process
+   SharedMemorySegment seg{"/celeritas-123-0", size};
+   std::memcpy(seg.mutable_data().data(), src, size);
+   barrier(comm);
+
+   // Other processes
+   barrier(comm);
+   SharedMemorySegment seg{"/celeritas-123-0"};
+ * \endcode
+ *
+ * \note Shared memory is not supported on Windows.
+ */
+class SharedMemorySegment
+{
+  public:
+    // Create a writable segment
+    SharedMemorySegment(std::string name, std::size_t size);
+
+    // Attach read-only to an existing segment
+    explicit SharedMemorySegment(std::string name);
+
+    // Unmap and (if owner) unlink
+    ~SharedMemorySegment();
+
+    CELER_DELETE_COPY_MOVE(SharedMemorySegment);
+
+    //// ACCESSORS ////
+
+    //! Segment name
+    std::string const& name() const { return name_; }
+
+    //! Whether this process created the segment
+    bool owner() const { return owner_; }
+
+    //! Segment contents
+    Span<std::byte const> data() const { return {addr_, size_}; }
+
+    // Writable segment contents (owner only)
+    Span<std::byte> mutable_data();
+
+    //// OPERATIONS ////
+
+    // Remove the name so that no further processes can attach
+    void unlink();
+
+  private:
+    std::string name_;
+    std::byte* addr_{nullptr};
+    std::size_t size_{0};
+    bool owner_{false};
+    bool linked_{false};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -34,7 +34,7 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StringUtils.hh"
 #include "corecel/sys/Environment.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "geocel/inp/Model.hh"
 
 #include "GeantGdmlLoader.hh"
@@ -718,8 +718,8 @@ std::shared_ptr<GeantGeoParams> GeantGeoParams::from_gdml(
         });
 
     // Create geo params
-    auto result
-        = std::make_shared<GeantGeoParams>(loaded.world, Ownership::value);
+    auto result = std::make_shared<GeantGeoParams>(
+        loaded.world, Ownership::value, filename);
     // We own constructed detectors (note that these live only on the main
     // thread and are not suitable for G4 MT: use DetectorConstruction instead)
     result->built_detectors_ = std::move(built_detectors);
@@ -732,16 +732,22 @@ std::shared_ptr<GeantGeoParams> GeantGeoParams::from_gdml(
 //---------------------------------------------------------------------------//
 /*!
  * Use an existing loaded Geant4 geometry.
+ *
+ * The GDML filename, if known, identifies the geometry source so that
+ * downstream geometry conversions can be cached.
  */
-GeantGeoParams::GeantGeoParams(G4VPhysicalVolume const* world, Ownership owns)
+GeantGeoParams::GeantGeoParams(G4VPhysicalVolume const* world,
+                               Ownership owns,
+                               std::string gdml_filename)
     : ownership_{owns}
+    , gdml_filename_{std::move(gdml_filename)}
     , geo_to_opt_(
           std::make_shared<GeoOpticalIdMap>(*G4Material::GetMaterialTable()))
 {
     CELER_EXPECT(world);
     data_.world = const_cast<G4VPhysicalVolume*>(world);
 
-    ScopedProfiling profile_this{"geant-geo-construct"};
+    ScopedSetupPhase record_phase{"geant-geo-construct"};
 
     // Verify consistency of the world volume
     G4VPhysicalVolume const* nav_world = geant_world_volume();
@@ -779,7 +785,7 @@ GeantGeoParams::GeantGeoParams(G4VPhysicalVolume const* world, Ownership owns)
         CELER_ASSERT(geo_man);
         if (!geo_man->IsGeometryClosed())
         {
-            ScopedProfiling profile_this{"geant-geo-close"};
+            ScopedSetupPhase record_close{"geant-geo-close"};
             CELER_LOG(debug) << "Building geometry manager tracking";
             auto optimize
                 = celeritas::getenv_flag("G4_GEO_OPTIMIZE", true).value;
@@ -94,7 +94,9 @@ class GeantGeoParams final : public GeoParamsInterface,
 
     // Create a VecGeom model from an already-loaded Geant4 geometry
     // TODO: also take model input? see #1815
-    GeantGeoParams(G4VPhysicalVolume const* world, Ownership owns);
+    GeantGeoParams(G4VPhysicalVolume const* world,
+                   Ownership owns,
+                   std::string gdml_filename = {});
 
     CELER_DEFAULT_MOVE_DELETE_COPY(GeantGeoParams);
 
@@ -171,6 +173,9 @@ class GeantGeoParams final : public GeoParamsInterface,
     // Get the world extents in Geant4 units and precision
     BoundingBox<double> get_clhep_bbox() const;
 
+    //! GDML file the geometry was loaded from (empty if unknown)
+    std::string const& gdml_filename() const { return gdml_filename_; }
+
     //// DATA ACCESS ////
 
     //! Access geometry data on host
@@ -190,6 +195,7 @@ class GeantGeoParams final : public GeoParamsInterface,
 
     Ownership ownership_{Ownership::reference};
     bool closed_geometry_{false};
+    std::string gdml_filename_;
     MapStrDetector built_detectors_;
 
     // Host metadata/access
@@ -328,7 +334,9 @@ inline std::shared_ptr<GeantGeoParams> GeantGeoParams::from_gdml(
     return std::make_shared<GeantGeoParams>(nullptr, Ownership::reference);
 }
 
-inline GeantGeoParams::GeantGeoParams(G4VPhysicalVolume const*, Ownership)
+inline GeantGeoParams::GeantGeoParams(G4VPhysicalVolume const*,
+                                      Ownership,
+                                      std::string)
 {
     CELER_NOT_CONFIGURED("Geant4");
 }
@@ -157,6 +157,7 @@ auto LarStandaloneRunner::operator()(VecSED const& sim_energy_deposits)
 
     // Allocate BTR helpers
     btr_helpers_.clear();
+    weight_remainders_.clear();
     for (auto i : range(channel_to_geo_.size()))
     {
         auto&& [iter, inserted] = btr_helpers_.emplace(
@@ -251,6 +252,11 @@ auto LarStandaloneRunner::operator()(VecSED const& sim_energy_deposits)
 //---------------------------------------------------------------------------//
 /*!
  * Convert Celeritas hits to optical backtracker records.
+ *
+ * Each hit represents as many physical photons as its weight, which is
+ * greater than one if photons were biased by Russian roulette. The
+ * backtracker records whole photons, so the fractional part of the weight is
+ * carried over to the next hit in the same detector to conserve the total.
  */
 void LarStandaloneRunner::hit(SpanCelerHits hits)
 {
@@ -261,6 +267,15 @@ void LarStandaloneRunner::hit(SpanCelerHits hits)
         auto btr_iter = btr_helpers_.find(h.volume_instance);
         CELER_ASSERT(btr_iter != btr_helpers_.end());
 
+        double& remainder = weight_remainders_[h.volume_instance];
+        double weight = static_cast<double>(h.weight) + remainder;
+        int num_photons = static_cast<int>(weight);
+        remainder = weight - num_photons;
+        if (num_photons == 0)
+        {
+            continue;
+        }
+
         // Note: BTR call requires a pointer, which ROOT doesn't support, so we
         // convert to a native quantity
         auto larpos = value_as<LarsoftLen>(make_quantity_array<LarsoftLen>(
@@ -268,7 +283,7 @@ void LarStandaloneRunner::hit(SpanCelerHits hits)
         btr_iter->second->AddScintillationPhotonsToMap(
             to_track_id(h.primary),
             convert_to_larsoft<LarsoftTime>(h.time),
-            /* num photons = */ 1,
+            num_photons,
             larpos.data(),
             value_as<units::MevEnergy>(h.energy));
     }
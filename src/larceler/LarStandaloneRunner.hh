@@ -84,6 +84,8 @@ class LarStandaloneRunner
     // Hit recorders for each celeritas volume instance ID
     std::unordered_map<VolumeInstanceId, std::unique_ptr<sim::OBTRHelper>>
         btr_helpers_;
+    // Fractional photon weight not yet recorded for each volume instance
+    std::unordered_map<VolumeInstanceId, double> weight_remainders_;
 
     void hit(SpanCelerHits);
 };
@@ -54,6 +54,10 @@ inp::OpticalStandaloneInput make_input_from_config(
         result.problem.limits.step_iters = step_iters;
     }
 
+    // Optical biasing
+    result.problem.biasing.roulette_steps = cfg.OpticalRouletteSteps();
+    result.problem.biasing.roulette_survival = cfg.OpticalRouletteSurvival();
+
     // Optical capacities
     result.problem.capacity.primaries = cfg.OpticalCapacityPrimaries();
     result.problem.capacity.tracks = cfg.OpticalCapacityTracks();
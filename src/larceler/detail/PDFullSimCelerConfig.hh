@@ -64,6 +64,18 @@ struct PDFullSimCelerConfig
             R"(Iterations before aborting stepping loop (0 for unlimited))"},
         0};
 
+    // Optical biasing
+    fhicl::Atom<size_type> OpticalRouletteSteps{
+        fhicl::Name{"OpticalRouletteSteps"},
+        fhicl::Comment{
+            R"(Steps between Russian roulette games (0 to disable))"},
+        0};
+
+    fhicl::Atom<double> OpticalRouletteSurvival{
+        fhicl::Name{"OpticalRouletteSurvival"},
+        fhicl::Comment{R"(Probability of surviving a roulette game)"},
+        0.5};
+
     fhicl::Atom<std::string> OutputFile{
         fhicl::Name{"OutputFile"},
         fhicl::Comment{R"(Celeritas output filename)"}};
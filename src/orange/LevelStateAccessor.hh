@@ -17,6 +17,12 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Access the 2D fields (i.e., {track slot, ulev}) of OrangeStateData.
+ *
+ * Tracks are grouped into tiles of \c 2^log2_tile adjacent slots, and within
+ * a tile the data are stored by level and then by track: \verbatim
+   index = (tile * num_univ_levels + ulev) * tile_size + (track % tile_size)
+   \endverbatim
+ * With a tile size of one, all levels of a track are contiguous.
  */
 class LevelStateAccessor
 {
@@ -93,9 +99,14 @@ CELER_FUNCTION LevelStateAccessor::LevelStateAccessor(
     StateRef const* states,
     TrackSlotId tid,
     UnivLevelId ulev_id)
-    : s_(*states), index_(tid.get() * scalars.num_univ_levels + ulev_id.get())
+    : s_(*states)
 {
     CELER_EXPECT(ulev_id < scalars.num_univ_levels);
+    size_type const shift = s_.log2_tile;
+    size_type const tile = tid.get() >> shift;
+    size_type const lane = tid.get() - (tile << shift);
+    index_ = ((tile * scalars.num_univ_levels + ulev_id.get()) << shift)
+             + lane;
 }
 
 //---------------------------------------------------------------------------//
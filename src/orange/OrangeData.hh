@@ -13,12 +13,14 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "geocel/BoundingBox.hh"  // IWYU pragma: keep
 
 #include "OrangeTypes.hh"
 
 #include "detail/BvhData.hh"
+#include "detail/VoxelGridData.hh"
 
 namespace celeritas
 {
@@ -267,6 +269,9 @@ struct SimpleUnitRecord
     // Bounding Volume Hierarchy tree parameters
     detail::BvhTreeRecord bvh_tree;
 
+    // Optional uniform voxel grid
+    detail::VoxelGridRecord voxel_grid;
+
     LocalVolumeId background{};  //!< Default if not in any other volume
     bool simple_safety{};
 
@@ -383,6 +388,9 @@ struct OrangeParamsData
     // BVH tree storage
     detail::BvhTreeData<W, M> bvh_tree_data;
 
+    // Voxel grid storage
+    detail::VoxelGridData<W, M> voxel_grid_data;
+
     // Low-level storage
     Items<LocalSurfaceId> local_surface_ids;
     Items<LocalVolumeId> local_volume_ids;
@@ -430,6 +438,7 @@ struct OrangeParamsData
         volume_instance_ids = other.volume_instance_ids;
 
         bvh_tree_data = other.bvh_tree_data;
+        voxel_grid_data = other.voxel_grid_data;
 
         local_surface_ids = other.local_surface_ids;
         local_volume_ids = other.local_volume_ids;
@@ -480,11 +489,13 @@ struct OrangeStateData
     StateItems<LocalSurfaceId> next_surf;
     StateItems<Sense> next_sense;
 
-    // State with dimensions {num_tracks, scalars.num_univ_levels}
+    // State with dimensions {num_tracks, scalars.num_univ_levels}, tiled by
+    // groups of 2^log2_tile tracks (see LevelStateAccessor)
     Items<Real3> pos;
     Items<Real3> dir;
     Items<LocalVolumeId> vol;
     Items<UnivId> univ;
+    size_type log2_tile{0};
 
     // Scratch space with dimensions {track}{max_intersections}
     Items<FaceId> temp_face;
@@ -543,6 +554,7 @@ struct OrangeStateData
         dir = other.dir;
         vol = other.vol;
         univ = other.univ;
+        log2_tile = other.log2_tile;
 
         temp_face = other.temp_face;
         temp_distance = other.temp_distance;
@@ -555,15 +567,22 @@ struct OrangeStateData
 
 //---------------------------------------------------------------------------//
 /*!
- * Resize geometry tracking states.
+ * Resize geometry tracking states with a tiled level layout.
+ *
+ * The per-level position, direction, volume, and universe of each group of
+ * \c 2^log2_tile adjacent tracks are interleaved so that sweeping over tracks
+ * at the same level reads contiguous memory. A zero value stores all levels
+ * of a track contiguously.
  */
 template<MemSpace M>
 inline void resize(OrangeStateData<Ownership::value, M>* data,
                    HostCRef<OrangeParamsData> const& params,
-                   size_type num_tracks)
+                   size_type num_tracks,
+                   size_type log2_tile)
 {
     CELER_EXPECT(data);
     CELER_EXPECT(num_tracks > 0);
+    CELER_EXPECT(log2_tile < 8 * sizeof(size_type));
 
     resize(&data->univ_level, num_tracks);
     resize(&data->surface_univ_level, num_tracks);
@@ -576,11 +595,15 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->next_surf, num_tracks);
     resize(&data->next_sense, num_tracks);
 
-    size_type num_track_univ = params.scalars.num_univ_levels * num_tracks;
+    // Round the number of tracks up to a whole number of tiles
+    size_type const tile_size = size_type(1) << log2_tile;
+    size_type num_track_univ = params.scalars.num_univ_levels
+                               * ceil_div(num_tracks, tile_size) * tile_size;
     resize(&data->pos, num_track_univ);
     resize(&data->dir, num_track_univ);
     resize(&data->vol, num_track_univ);
     resize(&data->univ, num_track_univ);
+    data->log2_tile = log2_tile;
 
     size_type num_track_isect = params.scalars.max_intersections * num_tracks;
     resize(&data->temp_face, num_track_isect);
@@ -590,5 +613,17 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     CELER_ENSURE(*data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Resize geometry tracking states with contiguous levels for each track.
+ */
+template<MemSpace M>
+inline void resize(OrangeStateData<Ownership::value, M>* data,
+                   HostCRef<OrangeParamsData> const& params,
+                   size_type num_tracks)
+{
+    return resize(data, params, num_tracks, 0);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
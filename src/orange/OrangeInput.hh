@@ -25,6 +25,7 @@
 #include "OrangeData.hh"
 #include "OrangeTypes.hh"
 #include "inp/Bvh.hh"
+#include "inp/VoxelGrid.hh"
 #include "surf/VariantSurface.hh"
 #include "transform/VariantTransform.hh"
 
@@ -33,6 +34,10 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Input definition for a single oriented bounding zone.
+ *
+ * The inner box must be entirely inside the volume, and the outer box must
+ * entirely enclose it. Both boxes are axis-aligned in the zone's coordinate
+ * system, which is related to the unit's by the given transform.
  */
 struct OrientedBoundingZoneInput
 {
@@ -40,11 +45,11 @@ struct OrientedBoundingZoneInput
     BBox inner;
     //! Outer bounding box
     BBox outer;
-    //! Local to global transformation
-    TransformId trans_id;
+    //! Transform from the zone to the unit coordinate system
+    VariantTransform transform;
 
     //! Whether the obz definition is valid
-    explicit operator bool() const { return inner && outer && trans_id; }
+    explicit operator bool() const { return inner && outer; }
 };
 
 //---------------------------------------------------------------------------//
@@ -181,8 +186,15 @@ struct ConstructionOptions
     //! Options for Bounding Volume Hierarchy (BVH) construction
     inp::BvhBuilder bvh_options;
 
+    //! Options for the optional voxel grid
+    inp::VoxelGridBuilder voxel_options;
+
     //! Whether the options are valid
-    explicit operator bool() const { return static_cast<bool>(bvh_options); }
+    explicit operator bool() const
+    {
+        return static_cast<bool>(bvh_options)
+               && static_cast<bool>(voxel_options);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -212,6 +224,9 @@ struct OrangeInput
     //! Logic expression notation
     LogicNotation logic{LogicNotation::postfix};
 
+    //! Wall time [s] to build each universe from protos (not serialized)
+    std::vector<double> build_times;
+
     //! Whether the unit definition is valid
     explicit operator bool() const
     {
@@ -6,7 +6,10 @@
 //---------------------------------------------------------------------------//
 #include "OrangeParams.hh"
 
+#include <cstdint>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <utility>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -19,8 +22,10 @@
 #include "corecel/data/StateDataStore.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/math/HashUtils.hh"
 #include "corecel/sys/Environment.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "geocel/BoundingBox.hh"
 #include "geocel/GeantGeoParams.hh"
 #include "geocel/VolumeParams.hh"
@@ -38,6 +43,7 @@
 
 #include "detail/ConvertLogic.hh"
 #include "detail/DepthCalculator.hh"
+#include "detail/OrangeParamsCache.hh"
 #include "detail/RectArrayInserter.hh"
 #include "detail/UnitInserter.hh"
 #include "detail/UniverseIndexer.hh"
@@ -96,6 +102,95 @@ ComponentLabels make_reserved_label_vecs(OrangeInput const& input)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Hash all inputs that affect an ORANGE geometry converted from GDML.
+ *
+ * This includes the GDML file contents, the conversion options, the
+ * environment variables read during conversion and by \c
+ * orangeinp::InputBuilder , and the build configuration that determines the
+ * binary data layout.
+ */
+std::uint64_t hash_geant_inputs(std::string const& gdml_filename,
+                                inp::OrangeGeoFromGeant const& opts)
+{
+    std::ifstream infile(gdml_filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open GDML file at '" << gdml_filename
+                   << "'");
+    std::ostringstream inputs;
+    inputs << infile.rdbuf();
+
+    inputs << '\0' << opts;
+    for (char const* var : {"G4ORG_ALLOW_ERRORS",
+                            "ORANGE_BVH_MAX_LEAF_SIZE",
+                            "ORANGE_BVH_DEPTH_LIMIT",
+                            "ORANGE_BVH_PART_CANDS",
+                            "ORANGE_BVH_WIDTH",
+                            "ORANGE_VOXEL_GRID"})
+    {
+        inputs << '\0' << celeritas::getenv(var);
+    }
+    inputs << '\0' << sizeof(real_type) << '\0' << CELERITAS_UNITS << '\0'
+           << static_cast<int>(orange_tracking_logic);
+
+    std::string const str = std::move(inputs).str();
+    return hash_as_bytes(Span<char const>{str.data(), str.size()});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether to cache a converted Geant4 geometry.
+ *
+ * This is true if \c ORANGE_CACHE_DIR is set and the geometry was loaded from
+ * a GDML file without requesting debug output.
+ */
+bool use_cache(GeantGeoParams const& geo, inp::OrangeGeoFromGeant const& opts)
+{
+    if (celeritas::getenv("ORANGE_CACHE_DIR").empty())
+    {
+        return false;
+    }
+    if (geo.gdml_filename().empty())
+    {
+        CELER_LOG(debug) << "Not caching ORANGE geometry: Geant4 geometry "
+                            "was not loaded from a GDML file";
+        return false;
+    }
+    if (!opts.objects_output_file.empty() || !opts.csg_output_file.empty()
+        || !opts.org_output_file.empty())
+    {
+        CELER_LOG(debug) << "Not caching ORANGE geometry: debug output was "
+                            "requested";
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the cache file for a converted Geant4 geometry.
+ *
+ * The file name includes the input hash so that GDML files with the same name
+ * (or the same file with different options) do not overwrite each other.
+ */
+std::string
+make_cache_filename(std::string const& gdml_filename, std::uint64_t input_hash)
+{
+    // Strip directory and extension from the GDML file
+    std::string stem = gdml_filename.substr(gdml_filename.rfind('/') + 1);
+    if (ends_with(stem, ".gdml"))
+    {
+        stem.erase(stem.size() - 5);
+    }
+
+    std::ostringstream os;
+    os << celeritas::getenv("ORANGE_CACHE_DIR") << '/' << stem << '-'
+       << std::hex << std::setfill('0') << std::setw(16) << input_hash
+       << ".org.bin";
+    return std::move(os).str();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -133,6 +228,12 @@ std::shared_ptr<OrangeParams> OrangeParams::from_gdml(
 //---------------------------------------------------------------------------//
 /*!
  * Build from a Geant4 world.
+ *
+ * If the \c ORANGE_CACHE_DIR environment variable is set and the Geant4
+ * geometry was loaded from GDML, the constructed geometry is saved to a binary
+ * file in that directory. Later runs with identical GDML contents, conversion
+ * options, and build configuration load it directly, skipping the conversion
+ * and construction of surfaces and acceleration structures.
  */
 std::shared_ptr<OrangeParams> OrangeParams::from_geant(
     std::shared_ptr<GeantGeoParams const> const& geo, SPConstVolumes volumes)
@@ -141,7 +242,7 @@ std::shared_ptr<OrangeParams> OrangeParams::from_geant(
     CELER_EXPECT(volumes);
     CELER_EXPECT(!volumes->empty());
 
-    ScopedProfiling profile_this{"orange-load-geant"};
+    ScopedSetupPhase record_phase{"orange-load-geant"};
 
     // Set up options for debug output
     inp::OrangeGeoFromGeant opts;
@@ -164,11 +265,46 @@ std::shared_ptr<OrangeParams> OrangeParams::from_geant(
         }
     }
 
+    // Load from a cached geometry if possible
+    std::string cache_filename;
+    std::uint64_t input_hash{0};
+    if (use_cache(*geo, opts))
+    {
+        input_hash = hash_geant_inputs(geo->gdml_filename(), opts);
+        cache_filename = make_cache_filename(geo->gdml_filename(), input_hash);
+        if (auto cached = detail::read_orange_cache(cache_filename, input_hash))
+        {
+            if (cached->num_volumes == volumes->num_volumes())
+            {
+                return std::make_shared<OrangeParams>(std::move(*cached),
+                                                      std::move(volumes));
+            }
+            CELER_LOG(warning)
+                << "Cached ORANGE geometry at '" << cache_filename << "' has "
+                << cached->num_volumes << " volumes but the Geant4 geometry "
+                << "has " << volumes->num_volumes() << ": rebuilding";
+        }
+    }
+
     // Convert G4 geometry to ORANGE input data structure
-    auto result = g4org::Converter{std::move(opts)}(*geo, *volumes).input;
+    auto input = g4org::Converter{std::move(opts)}(*geo, *volumes).input;
 
-    return std::make_shared<OrangeParams>(std::move(result),
-                                          std::move(volumes));
+    auto result = std::make_shared<OrangeParams>(std::move(input),
+                                                 std::move(volumes));
+    if (!cache_filename.empty())
+    {
+        // Save for subsequent runs: failure is not fatal
+        try
+        {
+            detail::write_orange_cache(cache_filename, input_hash, *result);
+        }
+        catch (std::exception const& e)
+        {
+            CELER_LOG(warning) << "Failed to write ORANGE geometry cache: "
+                               << e.what();
+        }
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -207,7 +343,7 @@ std::shared_ptr<OrangeParams> OrangeParams::from_json(
     std::string const& filename)
 {
     CELER_LOG(info) << "Loading ORANGE geometry from JSON at " << filename;
-    ScopedProfiling profile_this{"orange-load-json"};
+    ScopedSetupPhase record_phase{"orange-load-json"};
 
     OrangeInput result;
 
@@ -238,7 +374,7 @@ OrangeParams::OrangeParams(OrangeInput&& input, SPConstVolumes&& volumes)
 {
     CELER_VALIDATE(input, << "input geometry is incomplete");
 
-    ScopedProfiling profile_this{"orange-construct"};
+    ScopedSetupPhase record_phase{"orange-construct"};
     CELER_LOG(debug) << "Merging runtime data"
                      << (celeritas::device() ? " and copying to GPU" : "");
 
@@ -262,8 +398,10 @@ OrangeParams::OrangeParams(OrangeInput&& input, SPConstVolumes&& volumes)
     host_data.scalars.num_vol_levels = volumes_ ? volumes_->num_volume_levels()
                                                 : 0;
 
-    // Insert all universes
+    // Insert all universes, building acceleration structures
     {
+        ScopedSetupPhase record_insert{"orange-insert-universes"};
+
         ComponentLabels labels = make_reserved_label_vecs(input);
 
         detail::UniverseInserter insert_universe_base{volumes_,
@@ -276,9 +414,12 @@ OrangeParams::OrangeParams(OrangeInput&& input, SPConstVolumes&& volumes)
                 &insert_universe_base, &host_data, &(input.construction_opts)},
             detail::RectArrayInserter{&insert_universe_base, &host_data}};
 
+        insert_times_.reserve(input.universes.size());
         for (auto&& u : input.universes)
         {
+            Stopwatch get_time;
             std::visit(insert_universe, std::move(u));
+            insert_times_.push_back(get_time());
         }
 
         univ_labels_ = UniverseMap{"universe", std::move(labels.universe)};
@@ -289,6 +430,7 @@ OrangeParams::OrangeParams(OrangeInput&& input, SPConstVolumes&& volumes)
     }
 
     // Clear captured input since we've consumed and modified it
+    build_times_ = std::move(input.build_times);
     std::move(input) = {};
 
     // Simple safety if all SimpleUnits have simple safety and no RectArrays
@@ -342,6 +484,45 @@ OrangeParams::OrangeParams(OrangeInput&& input, SPConstVolumes&& volumes)
     CELER_ENSURE(bbox_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Advanced usage: construct from previously constructed data.
+ *
+ * The canonical volumes must correspond to the geometry that was cached.
+ */
+OrangeParams::OrangeParams(detail::OrangeCachedData&& cached,
+                           SPConstVolumes&& volumes)
+    : volumes_{std::move(volumes)}
+{
+    CELER_VALIDATE(cached.data, << "cached geometry is incomplete");
+
+    ScopedSetupPhase record_phase{"orange-construct-cached"};
+    CELER_LOG(debug) << "Loading cached runtime data"
+                     << (celeritas::device() ? " and copying to GPU" : "");
+
+    bbox_ = cached.bbox;
+    supports_safety_ = cached.supports_safety;
+    univ_labels_ = UniverseMap{"universe", std::move(cached.universe_labels)};
+    impl_surf_labels_
+        = SurfaceMap{"impl surface", std::move(cached.surface_labels)};
+    impl_vol_labels_
+        = ImplVolumeMap{"impl volume", std::move(cached.volume_labels)};
+
+    // Replace stale pointers for debug output
+    auto& host_data = cached.data;
+    host_data.scalars.host_geo_params = this;
+    host_data.scalars.host_volume_params = volumes_.get();
+    CELER_VALIDATE(host_data.volume_ids.size() == impl_vol_labels_.size(),
+                   << "cached geometry has inconsistent volume IDs");
+
+    // Construct device values and device/host references
+    data_ = ParamsDataStore{std::move(host_data)};
+
+    CELER_ENSURE(impl_surf_labels_ && univ_labels_ && impl_vol_labels_);
+    CELER_ENSURE(data_);
+    CELER_ENSURE(bbox_);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Create model parameters corresponding to our internal representation.
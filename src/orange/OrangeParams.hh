@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "corecel/Types.hh"
 #include "corecel/cont/LabelIdMultiMap.hh"
@@ -27,6 +28,10 @@ namespace celeritas
 struct OrangeInput;
 class GeantGeoParams;
 class VolumeParams;
+namespace detail
+{
+struct OrangeCachedData;
+}
 
 //---------------------------------------------------------------------------//
 /*!
@@ -44,6 +49,7 @@ class OrangeParams final : public GeoParamsInterface,
     using SurfaceMap = LabelIdMultiMap<ImplSurfaceId>;
     using UniverseMap = LabelIdMultiMap<UnivId>;
     using SPConstVolumes = std::shared_ptr<VolumeParams const>;
+    using VecDbl = std::vector<double>;
     //!@}
 
   public:
@@ -75,6 +81,9 @@ class OrangeParams final : public GeoParamsInterface,
     // ADVANCED usage: construct from explicit host data with volumes
     OrangeParams(OrangeInput&& input, SPConstVolumes&& volumes);
 
+    // ADVANCED usage: construct from previously constructed data
+    OrangeParams(detail::OrangeCachedData&& cached, SPConstVolumes&& volumes);
+
     // Default destructor to anchor vtable
     ~OrangeParams() final;
 
@@ -117,6 +126,12 @@ class OrangeParams final : public GeoParamsInterface,
     // Get the volume instance containing the global point
     VolumeInstanceId find_volume_instance_at(Real3 const&) const final;
 
+    //! Wall time [s] to build each universe from protos (may be empty)
+    VecDbl const& build_times() const { return build_times_; }
+
+    //! Wall time [s] to insert each universe and build its runtime data
+    VecDbl const& insert_times() const { return insert_times_; }
+
     //// DATA ACCESS ////
 
     //! Reference to CPU geometry data
@@ -132,6 +147,8 @@ class OrangeParams final : public GeoParamsInterface,
     ImplVolumeMap impl_vol_labels_;
     BBox bbox_;
     bool supports_safety_{};
+    VecDbl build_times_;
+    VecDbl insert_times_;
 
     // Retain volumes since we save a pointer for debugging
     SPConstVolumes volumes_;
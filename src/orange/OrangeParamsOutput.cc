@@ -9,9 +9,11 @@
 
 #include <nlohmann/json.hpp>
 
+#include "corecel/cont/ArrayIO.json.hh"
 #include "corecel/cont/LdgSpan.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/io/JsonPimpl.hh"
+#include "corecel/io/LabelIO.json.hh"
 #include "corecel/sys/Environment.hh"
 #include "geocel/BoundingBoxIO.json.hh"
 #include "orange/OrangeTypes.hh"
@@ -198,6 +200,56 @@ void OrangeParamsOutput::output(JsonPimpl* j) const
         }
     }
 
+    // Write voxel grid metadata if any unit has a grid
+    if (auto const& vgdata = data.voxel_grid_data; !vgdata.cells.empty())
+    {
+        auto dims = json::array();
+        auto num_candidates = json::array();
+        auto num_safe_cells = json::array();
+        double build_time = 0;
+        for (auto i : range(data.simple_units.size()))
+        {
+            auto const& grid = data.simple_units[SimpleUnitId{i}].voxel_grid;
+            if (!grid)
+            {
+                dims.push_back(nullptr);
+                num_candidates.push_back(nullptr);
+                num_safe_cells.push_back(nullptr);
+                continue;
+            }
+            dims.push_back(grid.dims);
+            num_candidates.push_back(grid.metadata.num_candidates);
+            num_safe_cells.push_back(grid.metadata.num_safe_cells);
+            build_time += grid.metadata.build_time;
+        }
+
+        obj["voxel_grid"] = {
+            {"dims", std::move(dims)},
+            {"num_candidates", std::move(num_candidates)},
+            {"num_safe_cells", std::move(num_safe_cells)},
+            {"build_time", build_time},
+            {"memory",
+             vgdata.cells.size() * sizeof(detail::VoxelCell)
+                 + vgdata.local_volume_ids.size() * sizeof(LocalVolumeId)},
+        };
+    }
+
+    // Write construction time for each universe
+    {
+        auto labels = json::array();
+        auto const& univ_labels = orange_->universes();
+        for (auto i : range(UnivId{univ_labels.size()}))
+        {
+            labels.push_back(univ_labels.at(i));
+        }
+
+        obj["universe_timing"] = {
+            {"label", std::move(labels)},
+            {"build", orange_->build_times()},
+            {"insert", orange_->insert_times()},
+        };
+    }
+
     j->obj = std::move(obj);
 }
 
@@ -35,6 +35,7 @@ BvhBuilder::BvhBuilder(Storage* storage, Input inp)
     : bboxes_{&storage->bboxes}
     , local_volume_ids_{&storage->local_volume_ids}
     , internal_nodes_{&storage->internal_nodes}
+    , wide_nodes_{&storage->wide_nodes}
     , leaf_nodes_{&storage->leaf_nodes}
     , inp_{inp}
 {
@@ -51,6 +52,11 @@ BvhBuilder::BvhBuilder(Storage* storage, Input inp)
     CELER_VALIDATE(inp_.num_part_cands > 0,
                    << "invalid BVH partition candidate count "
                    << inp_.num_part_cands << ": must be positive");
+    CELER_VALIDATE(inp_.width >= 2 && inp_.width <= max_bvh_width,
+                   << "invalid BVH width " << inp_.width
+                   << ": must be at least 2 and no more than compile-time "
+                      "maximum "
+                   << max_bvh_width);
 }
 
 //---------------------------------------------------------------------------//
@@ -128,6 +134,13 @@ BvhTreeRecord BvhBuilder::operator()(
         tree.internal_nodes = internal_nodes_.insert_back(
             internal_nodes.begin(), internal_nodes.end());
 
+        if (inp_.width > 2 && !internal_nodes.empty())
+        {
+            auto wide_nodes = this->make_wide_nodes(internal_nodes);
+            tree.wide_nodes = wide_nodes_.insert_back(wide_nodes.begin(),
+                                                      wide_nodes.end());
+        }
+
         tree.leaf_nodes
             = leaf_nodes_.insert_back(leaf_nodes.begin(), leaf_nodes.end());
     }
@@ -284,6 +297,82 @@ BvhBuilder::ArrangedNodes BvhBuilder::arrange_nodes(VecNodes const& nodes) const
 
     return {std::move(internal_nodes), std::move(leaf_nodes)};
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collapse each internal node with its descendants into a wide node.
+ *
+ * Starting from the two edges of each node, the internal child whose edge has
+ * the largest surface area is replaced by its own two edges until the width
+ * is reached or all children are leaves. Since edge bounding boxes are
+ * already clipped by all bounding planes between the root and the edge, the
+ * descendants' edge boxes are used directly. Child order is preserved so that
+ * traversal visits the same left-to-right order as the binary tree.
+ *
+ * \param[in] nodes  Internal nodes after arrangement
+ *
+ * \returns A wide node for each internal node
+ */
+auto BvhBuilder::make_wide_nodes(VecInnerNodes const& nodes) const
+    -> VecWideNodes
+{
+    using Edge = BvhInternalNode::Edge;
+
+    auto is_internal = [&nodes](Edge const& e) {
+        return e.child.unchecked_get() < nodes.size();
+    };
+
+    VecWideNodes result(nodes.size());
+    std::vector<Edge> edges;
+    for (auto i : range(nodes.size()))
+    {
+        edges.assign(nodes[i].edges.begin(), nodes[i].edges.end());
+        while (edges.size() < inp_.width)
+        {
+            // Find the internal child with the largest edge bbox
+            auto expand = edges.end();
+            fast_real_type max_area = -1;
+            for (auto iter = edges.begin(); iter != edges.end(); ++iter)
+            {
+                if (!is_internal(*iter))
+                {
+                    continue;
+                }
+                auto area = calc_surface_area(iter->bbox);
+                if (area > max_area)
+                {
+                    max_area = area;
+                    expand = iter;
+                }
+            }
+            if (expand == edges.end())
+            {
+                // All children are leaves
+                break;
+            }
+
+            // Replace with its children, preserving order
+            auto const& child = nodes[expand->child.unchecked_get()];
+            *expand = child.edges[BvhInternalNode::Side::right];
+            edges.insert(expand, child.edges[BvhInternalNode::Side::left]);
+        }
+
+        // Pack the child edges; unused lanes are zero-initialized
+        BvhWideNode& wide = result[i];
+        for (auto j : range(edges.size()))
+        {
+            wide.children[j] = edges[j].child;
+            for (auto ax : range(Axis::size_))
+            {
+                wide.lower[to_int(ax)][j] = edges[j].bbox.point(Bound::lo, ax);
+                wide.upper[to_int(ax)][j] = edges[j].bbox.point(Bound::hi, ax);
+            }
+        }
+        CELER_ASSERT(wide);
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -45,6 +45,10 @@ namespace detail
  * not occur unless an ORANGE geometry is created via a method where volume
  * bounding boxes are not available.
  *
+ * If the input \c width is greater than two, each internal node is also
+ * collapsed into a "wide" node whose children are tested together during
+ * traversal.
+ *
  * Bounding boxes supplied to this builder should "bumped," i.e. expanded
  * outward by at least floating-point epsilson from the volumes they bound.
  * This eliminates the possibility of accidentally missing a volume during
@@ -76,6 +80,7 @@ class BvhBuilder
     using VecIndices = std::vector<LocalVolumeId>;
     using VecNodes = std::vector<std::variant<BvhInternalNode, BvhLeafNode>>;
     using VecInnerNodes = std::vector<BvhInternalNode>;
+    using VecWideNodes = std::vector<BvhWideNode>;
     using VecLeafNodes = std::vector<BvhLeafNode>;
     using ArrangedNodes = std::pair<VecInnerNodes, VecLeafNodes>;
 
@@ -91,6 +96,7 @@ class BvhBuilder
     CollectionBuilder<FastBBox> bboxes_;
     CollectionBuilder<LocalVolumeId> local_volume_ids_;
     CollectionBuilder<BvhInternalNode> internal_nodes_;
+    CollectionBuilder<BvhWideNode> wide_nodes_;
     CollectionBuilder<BvhLeafNode> leaf_nodes_;
 
     Input inp_;
@@ -105,6 +111,9 @@ class BvhBuilder
 
     // Separate nodes into inner and leaf vectors and renumber accordingly
     ArrangedNodes arrange_nodes(VecNodes const& nodes) const;
+
+    // Collapse each internal node with its descendants into a wide node
+    VecWideNodes make_wide_nodes(VecInnerNodes const& nodes) const;
 };
 
 //---------------------------------------------------------------------------//
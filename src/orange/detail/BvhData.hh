@@ -8,6 +8,7 @@
 #pragma once
 
 #include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/data/Collection.hh"
 #include "geocel/BoundingBox.hh"  // IWYU pragma: keep
@@ -22,6 +23,10 @@ namespace detail
 // The maximum depth of the BVH tree (single leaf node is 1)
 inline constexpr size_type max_bvh_depth = 18;
 
+//---------------------------------------------------------------------------//
+// The maximum number of children of a wide BVH node
+inline constexpr size_type max_bvh_width = 4;
+
 //---------------------------------------------------------------------------//
 /*!
  * Data for a single internal node in a Bounding Volume Hierarchy.
@@ -61,6 +66,31 @@ struct BvhInternalNode
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Data for a collapsed internal node in a wide Bounding Volume Hierarchy.
+ *
+ * A wide node replaces the binary internal node with the same ID. Its
+ * children are the binary descendants found by repeatedly expanding the
+ * internal child with the largest edge bounding box, so that up to \c
+ * max_bvh_width edges are tested at once. The edge bounding boxes are packed
+ * by axis so that a point or ray can be tested against all children with
+ * short fixed-length loops. Unused children have a null ID.
+ */
+struct BvhWideNode
+{
+    using Lanes = Array<fast_real_type, max_bvh_width>;
+
+    Array<BvhNodeId, max_bvh_width> children;  //!< Child nodes
+    Array<Lanes, 3> lower;  //!< Lower edge bbox coordinate [axis][child]
+    Array<Lanes, 3> upper;  //!< Upper edge bbox coordinate [axis][child]
+
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return this->children[0] && this->children[1];
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Data for a single leaf node in a Bounding Volume Hierarchy.
@@ -102,6 +132,9 @@ struct BvhTreeRecord
     //! Internal (branch) nodes, the first being the root
     ItemRange<BvhInternalNode> internal_nodes;
 
+    //! Wide nodes corresponding to each internal node (optional)
+    ItemRange<BvhWideNode> wide_nodes;
+
     //! Leaf nodes
     ItemRange<BvhLeafNode> leaf_nodes;
 
@@ -117,7 +150,9 @@ struct BvhTreeRecord
     {
         if (!internal_nodes.empty())
         {
-            return !bboxes.empty() && !leaf_nodes.empty();
+            return !bboxes.empty() && !leaf_nodes.empty()
+                   && (wide_nodes.empty()
+                       || wide_nodes.size() == internal_nodes.size());
         }
         else
         {
@@ -145,6 +180,7 @@ struct BvhTreeData
     Items<FastBBox> bboxes;
     Items<LocalVolumeId> local_volume_ids;
     Items<detail::BvhInternalNode> internal_nodes;
+    Items<detail::BvhWideNode> wide_nodes;
     Items<detail::BvhLeafNode> leaf_nodes;
 
     //! True if assigned
@@ -162,6 +198,7 @@ struct BvhTreeData
         bboxes = other.bboxes;
         local_volume_ids = other.local_volume_ids;
         internal_nodes = other.internal_nodes;
+        wide_nodes = other.wide_nodes;
         leaf_nodes = other.leaf_nodes;
 
         CELER_ENSURE(static_cast<bool>(*this) == static_cast<bool>(other));
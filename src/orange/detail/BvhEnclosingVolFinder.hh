@@ -28,6 +28,9 @@ namespace detail
  * operations, a predicate that excludes the volume a particle is in prior to
  * the crossing may be used.
  *
+ * If the tree has wide nodes, all children of a node are tested together and
+ * the matching ones are visited in left-to-right order.
+ *
  * \todo move to top-level orange directory out of detail namespace
  */
 class BvhEnclosingVolFinder
@@ -53,6 +56,11 @@ class BvhEnclosingVolFinder
 
     //// HELPER FUNCTIONS ////
 
+    // Find a volume by traversing the wide nodes
+    template<class F>
+    inline CELER_FUNCTION LocalVolumeId find_wide(Real3 const& pos,
+                                                  F&& is_inside) const;
+
     // Determine if any leaf node volumes contain the point
     template<class F>
     inline CELER_FUNCTION LocalVolumeId visit_leaf(BvhNodeId leaf_id,
@@ -89,6 +97,11 @@ CELER_FUNCTION LocalVolumeId BvhEnclosingVolFinder::operator()(
 {
     using Side = BvhInternalNode::Side;
 
+    if (view_.is_wide())
+    {
+        return this->find_wide(pos, is_inside_vol);
+    }
+
     // Stack of deferred nodes
     using StackT = IdStack<BvhNodeId, max_bvh_depth - 1>;
     BvhNodeId stack_spill_[StackT::spill_extent];
@@ -126,6 +139,52 @@ CELER_FUNCTION LocalVolumeId BvhEnclosingVolFinder::operator()(
 
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Find a volume by traversing the wide nodes.
+ *
+ * Each visited node can defer all but one of its children, so the stack is
+ * larger than for the binary tree.
+ */
+template<class F>
+CELER_FUNCTION LocalVolumeId
+BvhEnclosingVolFinder::find_wide(Real3 const& pos, F&& is_inside_vol) const
+{
+    // Stack of deferred nodes
+    using StackT
+        = IdStack<BvhNodeId, (max_bvh_width - 1) * (max_bvh_depth - 1)>;
+    BvhNodeId stack_spill_[StackT::spill_extent];
+    StackT stack{stack_spill_};
+    stack.push(BvhNodeId{0});
+
+    while (!stack.empty())
+    {
+        BvhNodeId id = stack.top();
+        stack.pop();
+        if (!view_.is_internal(id))
+        {
+            if (auto vol_id = this->visit_leaf(id, is_inside_vol))
+            {
+                return vol_id;
+            }
+            continue;
+        }
+
+        auto const node = view_.wide_node(id);
+        auto const hits = node.contains(pos);
+        // Push in reverse so the leftmost child is visited first
+        for (size_type j = node.width(); j-- > 0;)
+        {
+            if (hits[j])
+            {
+                stack.push(node.child(j));
+            }
+        }
+    }
+
+    return this->visit_inf_vols(is_inside_vol);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Determine if any leaf node volumes contain the point.
@@ -33,6 +33,9 @@ namespace detail
  * minimumium intersection with a actual volume if found (NOT a nearer
  * intersection with an edge bbox).
  *
+ * If the tree has wide nodes, the segment is tested against all children of a
+ * node together.
+ *
  * \todo move to top-level orange directory out of detail namespace
  */
 class BvhIntersectingVolFinder
@@ -65,6 +68,11 @@ class BvhIntersectingVolFinder
 
     //// HELPER FUNCTIONS ////
 
+    // Calculate the minimum intersection by traversing the wide nodes
+    template<class F>
+    inline CELER_FUNCTION Intersection
+    find_wide(Ray ray, F&& visit_vol, Intersection intersection) const;
+
     // Determine if the intersection with an edge/vol bbox is less than
     // min_dist
     inline CELER_FUNCTION bool visit_bbox(
@@ -118,6 +126,11 @@ CELER_FUNCTION auto BvhIntersectingVolFinder::operator()(
 
     Intersection intersection{OnLocalSurface{}, max_search_dist};
 
+    if (view_.is_wide())
+    {
+        return this->find_wide(ray, visit_vol, intersection);
+    }
+
     // Stack of deferred nodes
     using StackT = IdStack<BvhNodeId, max_bvh_depth - 1>;
     BvhNodeId stack_spill_[StackT::spill_extent];
@@ -167,6 +180,73 @@ CELER_FUNCTION auto BvhIntersectingVolFinder::operator()(
 }
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the minimum intersection by traversing the wide nodes.
+ *
+ * The children whose edge boxes are hit are visited in order of the distance
+ * to their centers along the ray, so that nearer intersections can prune
+ * farther nodes. This generalizes the axis-based choice of the first edge in
+ * the binary traversal.
+ */
+template<class F>
+CELER_FUNCTION auto
+BvhIntersectingVolFinder::find_wide(BvhIntersectingVolFinder::Ray ray,
+                                    F&& visit_vol,
+                                    Intersection intersection) const
+    -> Intersection
+{
+    // Stack of deferred nodes
+    using StackT
+        = IdStack<BvhNodeId, (max_bvh_width - 1) * (max_bvh_depth - 1)>;
+    BvhNodeId stack_spill_[StackT::spill_extent];
+    StackT stack{stack_spill_};
+    stack.push(BvhNodeId{0});
+
+    while (!stack.empty())
+    {
+        BvhNodeId id = stack.top();
+        stack.pop();
+        if (!view_.is_internal(id))
+        {
+            intersection = this->visit_leaf(id, intersection, visit_vol);
+            continue;
+        }
+
+        auto const node = view_.wide_node(id);
+        auto const hits
+            = node.intersects(ray.pos, ray.dir, intersection.distance);
+        auto const dist = node.calc_center_distances(ray.pos, ray.dir);
+
+        // Sort hit children from farthest to nearest
+        Array<size_type, max_bvh_width> order;
+        size_type num_hits = 0;
+        for (size_type j = 0; j < node.width(); ++j)
+        {
+            if (hits[j])
+            {
+                order[num_hits++] = j;
+            }
+        }
+        for (size_type i = 1; i < num_hits; ++i)
+        {
+            for (size_type k = i; k > 0 && dist[order[k - 1]] < dist[order[k]];
+                 --k)
+            {
+                trivial_swap(order[k - 1], order[k]);
+            }
+        }
+
+        // Push so that the nearest child is visited first
+        for (size_type i = 0; i < num_hits; ++i)
+        {
+            stack.push(node.child(order[i]));
+        }
+    }
+
+    return this->visit_inf_vols(intersection, visit_vol);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Determine if the intersection with an edge/vol bbox is less than min_dist.
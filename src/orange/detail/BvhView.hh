@@ -6,6 +6,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
+#include "corecel/math/NumericLimits.hh"
 #include "orange/OrangeTypes.hh"
 
 #include "BvhData.hh"
@@ -43,6 +46,49 @@ class BvhInternalNodeView
     BvhInternalNode const& node_;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access and test the packed children of a wide BVH node.
+ *
+ * The tests evaluate every child with branch-free fixed-length loops so that
+ * the compiler can vectorize them on the host. Unused children are never
+ * selected.
+ */
+class BvhWideNodeView
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Mask = Array<bool, max_bvh_width>;
+    using Lanes = BvhWideNode::Lanes;
+    //!@}
+
+  public:
+    // Construct from wide node data
+    inline CELER_FUNCTION explicit BvhWideNodeView(BvhWideNode const& node);
+
+    //! Maximum number of children
+    static CELER_CONSTEXPR_FUNCTION size_type width() { return max_bvh_width; }
+
+    // Get a child node, which is null if unused
+    inline CELER_FUNCTION BvhNodeId child(size_type i) const;
+
+    // Find the children whose edge bounding boxes contain a point
+    inline CELER_FUNCTION Mask contains(Real3 const& pos) const;
+
+    // Find the children whose edge bounding boxes may intersect a segment
+    inline CELER_FUNCTION Mask intersects(Real3 const& pos,
+                                          Real3 const& dir,
+                                          real_type distance) const;
+
+    // Calculate the distance along a ray to each child's bbox center
+    inline CELER_FUNCTION Lanes calc_center_distances(Real3 const& pos,
+                                                      Real3 const& dir) const;
+
+  private:
+    BvhWideNode const& node_;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Traverse BVH tree using a depth-first search.
@@ -68,6 +114,12 @@ class BvhView
     // Get an internal node for a given BvhNodeId
     inline CELER_FUNCTION BvhInternalNodeView inner_node(BvhNodeId id) const;
 
+    // Whether internal nodes have been collapsed into wide nodes
+    inline CELER_FUNCTION bool is_wide() const;
+
+    // Get the wide node for a given internal BvhNodeId
+    inline CELER_FUNCTION BvhWideNodeView wide_node(BvhNodeId id) const;
+
     // Get number of internal nodes
     inline CELER_FUNCTION size_type num_internal_nodes() const;
 
@@ -134,6 +186,143 @@ CELER_FUNCTION FastBBox const& BvhInternalNodeView::bbox(
     return node_.edges[side].bbox;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from wide node data.
+ */
+CELER_FUNCTION BvhWideNodeView::BvhWideNodeView(BvhWideNode const& node)
+    : node_(node)
+{
+    CELER_EXPECT(node_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a child node, which is null if unused.
+ */
+CELER_FUNCTION BvhNodeId BvhWideNodeView::child(size_type i) const
+{
+    CELER_EXPECT(i < max_bvh_width);
+    return node_.children[i];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the children whose edge bounding boxes contain a point.
+ *
+ * This is equivalent to \c is_inside for each child's edge bounding box.
+ */
+CELER_FUNCTION auto BvhWideNodeView::contains(Real3 const& pos) const -> Mask
+{
+    Mask result;
+    for (size_type j = 0; j < max_bvh_width; ++j)
+    {
+        result[j] = static_cast<bool>(node_.children[j]);
+    }
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        auto const p = static_cast<fast_real_type>(pos[ax]);
+        auto const& lower = node_.lower[ax];
+        auto const& upper = node_.upper[ax];
+        for (size_type j = 0; j < max_bvh_width; ++j)
+        {
+            result[j] = result[j] & (lower[j] <= p) & (p <= upper[j]);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the children whose edge bounding boxes may intersect a segment.
+ *
+ * This is equivalent to \c intersects_segment (a separating axis test) for
+ * each child's edge bounding box, and it may have false positives.
+ */
+CELER_FUNCTION auto
+BvhWideNodeView::intersects(Real3 const& pos,
+                            Real3 const& dir,
+                            real_type distance) const -> Mask
+{
+    CELER_EXPECT(distance > 0);
+    using T = fast_real_type;
+    constexpr T eps = numeric_limits<T>::epsilon();
+
+    // Half-segment vector, which is the same for all children
+    T const half_distance = distance / 2;
+    Array<T, 3> hseg;
+    Array<T, 3> abs_hseg;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        hseg[ax] = dir[ax] * half_distance;
+        abs_hseg[ax] = std::fabs(hseg[ax]) + eps;
+    }
+
+    // Half-widths of each box and segment midpoint relative to box center
+    Array<Lanes, 3> hw;
+    Array<Lanes, 3> mid;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        auto const& lower = node_.lower[ax];
+        auto const& upper = node_.upper[ax];
+        for (size_type j = 0; j < max_bvh_width; ++j)
+        {
+            hw[ax][j] = (upper[j] - lower[j]) / 2;
+            mid[ax][j] = pos[ax] + hseg[ax] - (lower[j] + upper[j]) / 2;
+        }
+    }
+
+    Mask result;
+    for (size_type j = 0; j < max_bvh_width; ++j)
+    {
+        // Separating axes orthogonal to the faces
+        bool sep = false;
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            sep = sep | (std::fabs(mid[ax][j]) > hw[ax][j] + abs_hseg[ax]);
+        }
+        // Separating axes normal to pairs of faces and the direction
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            int const u = (ax + 1) % 3;
+            int const v = (ax + 2) % 3;
+            sep = sep
+                  | (std::fabs(mid[u][j] * hseg[v] - mid[v][j] * hseg[u])
+                     > hw[u][j] * abs_hseg[v] + hw[v][j] * abs_hseg[u]);
+        }
+        result[j] = static_cast<bool>(node_.children[j]) & !sep;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the distance along a ray to each child's bbox center.
+ *
+ * This is the projection of the vector from the ray origin to each center
+ * onto the ray direction, used to visit nearer children first.
+ */
+CELER_FUNCTION auto
+BvhWideNodeView::calc_center_distances(Real3 const& pos,
+                                       Real3 const& dir) const -> Lanes
+{
+    Lanes result;
+    for (size_type j = 0; j < max_bvh_width; ++j)
+    {
+        result[j] = 0;
+    }
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        auto const& lower = node_.lower[ax];
+        auto const& upper = node_.upper[ax];
+        for (size_type j = 0; j < max_bvh_width; ++j)
+        {
+            result[j] += ((lower[j] + upper[j]) / 2 - pos[ax]) * dir[ax];
+        }
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from vector of bounding boxes and storage.
@@ -165,6 +354,26 @@ CELER_FUNCTION BvhInternalNodeView BvhView::inner_node(BvhNodeId id) const
         storage_.internal_nodes[tree_.internal_nodes[id.unchecked_get()]]};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ *  Whether internal nodes have been collapsed into wide nodes.
+ */
+CELER_FUNCTION bool BvhView::is_wide() const
+{
+    return !tree_.wide_nodes.empty();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ *  Get the wide node for a given internal BvhNodeId.
+ */
+CELER_FUNCTION BvhWideNodeView BvhView::wide_node(BvhNodeId id) const
+{
+    CELER_EXPECT(this->is_wide() && this->is_internal(id));
+    return BvhWideNodeView{
+        storage_.wide_nodes[tree_.wide_nodes[id.unchecked_get()]]};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  *  Get number of internal nodes.
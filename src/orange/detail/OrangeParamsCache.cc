@@ -0,0 +1,224 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeParamsCache.cc
+//---------------------------------------------------------------------------//
+#include "OrangeParamsCache.hh"
+
+#include <type_traits>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/BinaryArchive.hh"
+#include "corecel/io/BinaryFile.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/ScopedProfiling.hh"
+#include "geocel/VolumeParams.hh"
+
+#include "../OrangeParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// COLLECTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Read or write a host collection of plain records as raw bytes.
+ *
+ * All ORANGE records are trivially copyable: they reference other data only
+ * through IDs and item ranges, never pointers.
+ */
+template<class Ar, class T, Ownership W, class I>
+void serialize(Ar& ar, Collection<T, W, MemSpace::host, I>& c)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "cached collection items must be trivially copyable");
+    if constexpr (Ar::is_loading)
+    {
+        static_assert(W == Ownership::value, "cannot load into a reference");
+        std::uint64_t size{};
+        ar(size);
+        CELER_VALIDATE(size <= ar.remaining() / sizeof(T),
+                       << "binary data is truncated");
+        resize(&c, size);
+        ar.read_bytes(c.data().get(), size * sizeof(T));
+    }
+    else
+    {
+        ar(static_cast<std::uint64_t>(c.size()));
+        ar.write_bytes(c.data().get(), c.size() * sizeof(T));
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, Label& v)
+{
+    ar(v.name, v.ext);
+}
+
+//---------------------------------------------------------------------------//
+template<class Ar, Ownership W>
+void serialize(Ar& ar, UniverseIndexerData<W, MemSpace::host>& v)
+{
+    ar(v.surfaces, v.volumes);
+}
+
+//---------------------------------------------------------------------------//
+template<class Ar, Ownership W>
+void serialize(Ar& ar, OrangeParamsData<W, MemSpace::host>& v)
+{
+    static_assert(std::is_trivially_copyable_v<OrangeParamsScalars>);
+    if constexpr (Ar::is_loading)
+    {
+        ar.read_bytes(&v.scalars, sizeof(v.scalars));
+    }
+    else
+    {
+        ar.write_bytes(&v.scalars, sizeof(v.scalars));
+    }
+
+    ar(v.univ_types,
+       v.univ_indices,
+       v.simple_units,
+       v.rect_arrays,
+       v.transforms,
+       v.volume_ids,
+       v.volume_instance_ids,
+       v.bvh_tree_data,
+       v.voxel_grid_data,
+       v.local_surface_ids,
+       v.local_volume_ids,
+       v.real_ids,
+       v.vl_uints,
+       v.logic_ints,
+       v.reals,
+       v.surface_types,
+       v.connectivity_records,
+       v.volume_records,
+       v.daughters,
+       v.obz_records,
+       v.univ_indexer_data);
+}
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+template<class Ar, Ownership W>
+void serialize(Ar& ar, BvhTreeData<W, MemSpace::host>& v)
+{
+    ar(v.bboxes, v.local_volume_ids, v.internal_nodes, v.wide_nodes, v.leaf_nodes);
+}
+
+//---------------------------------------------------------------------------//
+template<class Ar, Ownership W>
+void serialize(Ar& ar, VoxelGridData<W, MemSpace::host>& v)
+{
+    ar(v.cells, v.local_volume_ids);
+}
+
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Construct the file key for cached ORANGE data
+BinaryFileKey make_key(std::uint64_t input_hash)
+{
+    return {"OrangeParamsData", input_hash};
+}
+
+//---------------------------------------------------------------------------//
+//! Get all labels from a label map
+template<class M>
+std::vector<Label> get_labels(M const& labels)
+{
+    using IdT = typename M::IdT;
+    std::vector<Label> result;
+    result.reserve(labels.size());
+    for (auto id : range(IdT{labels.size()}))
+    {
+        result.push_back(labels.at(id));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load constructed ORANGE data from a binary cache if it matches the hash.
+ *
+ * The hash should combine every input that affects the constructed geometry:
+ * see \c OrangeParams::from_geant . If the cache is missing or stale, the
+ * reason is logged and no data is returned.
+ */
+std::optional<OrangeCachedData>
+read_orange_cache(std::string const& filename, std::uint64_t input_hash)
+{
+    CELER_EXPECT(!filename.empty());
+
+    ScopedProfiling profile_this{"read-orange-cache"};
+
+    MappedBinaryFile cached{filename, make_key(input_hash)};
+    if (!cached)
+    {
+        CELER_LOG(info) << "Not using cached ORANGE geometry at '"
+                        << filename << "': " << cached.reason();
+        return std::nullopt;
+    }
+
+    CELER_LOG(info) << "Loading cached ORANGE geometry from '" << filename
+                    << "'";
+    std::optional<OrangeCachedData> result{std::in_place};
+    BinaryReader read{cached.payload()};
+    read(result->data,
+         result->universe_labels,
+         result->surface_labels,
+         result->volume_labels);
+    read.read_bytes(&result->bbox, sizeof(BBox));
+    read(result->supports_safety, result->num_volumes);
+    CELER_VALIDATE(read.remaining() == 0,
+                   << "cached ORANGE geometry at '" << filename << "' has "
+                   << read.remaining() << " unread bytes");
+    CELER_VALIDATE(result->data,
+                   << "cached ORANGE geometry at '" << filename
+                   << "' is incomplete");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save constructed ORANGE data to a binary cache file.
+ */
+void write_orange_cache(std::string const& filename,
+                        std::uint64_t input_hash,
+                        OrangeParams const& params)
+{
+    CELER_EXPECT(!filename.empty());
+    static_assert(std::is_trivially_copyable_v<BBox>);
+
+    ScopedProfiling profile_this{"write-orange-cache"};
+
+    VolumeId::size_type num_volumes
+        = params.volumes() ? params.volumes()->num_volumes() : 0;
+
+    std::string payload;
+    BinaryWriter write{&payload};
+    write(params.host_ref(),
+          get_labels(params.universes()),
+          get_labels(params.surfaces()),
+          get_labels(params.impl_volumes()));
+    write.write_bytes(&params.bbox(), sizeof(BBox));
+    write(params.supports_safety(), num_volumes);
+    write_binary_file(filename, make_key(input_hash), payload);
+
+    CELER_LOG(info) << "Wrote " << payload.size()
+                    << " bytes of cached ORANGE geometry to '" << filename
+                    << "'";
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
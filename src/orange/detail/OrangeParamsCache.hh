@@ -0,0 +1,55 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeParamsCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "corecel/io/Label.hh"
+#include "geocel/BoundingBox.hh"
+
+#include "../OrangeData.hh"
+
+namespace celeritas
+{
+class OrangeParams;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fully constructed ORANGE data that can be saved between runs.
+ *
+ * This is everything in \c OrangeParams except the canonical volumes, which
+ * are always rebuilt from the Geant4 geometry.
+ */
+struct OrangeCachedData
+{
+    HostVal<OrangeParamsData> data;
+    std::vector<Label> universe_labels;
+    std::vector<Label> surface_labels;
+    std::vector<Label> volume_labels;
+    BBox bbox;
+    bool supports_safety{};
+    VolumeId::size_type num_volumes{};
+};
+
+//---------------------------------------------------------------------------//
+// Load constructed ORANGE data from a binary cache if it matches the hash
+std::optional<OrangeCachedData>
+read_orange_cache(std::string const& filename, std::uint64_t input_hash);
+
+// Save constructed ORANGE data to a binary cache file
+void write_orange_cache(std::string const& filename,
+                        std::uint64_t input_hash,
+                        OrangeParams const& params);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <iostream>
 #include <numeric>
 #include <regex>
@@ -24,6 +25,7 @@
 #include "corecel/io/Join.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "corecel/sys/Environment.hh"
 #include "orange/OrangeData.hh"
 #include "orange/OrangeTypes.hh"
@@ -212,6 +214,46 @@ BoundingBoxBumper<fast_real_type, real_type> make_bumper(Tolerance<> const& tol)
     return BoundingBoxBumper<fast_real_type, real_type>(std::move(bbox_tol));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate conservative single-precision half widths of an inner box.
+ *
+ * The inner box of an oriented bounding zone provides a safety distance, so
+ * unlike other bounding boxes it must be shrunk rather than bumped outward.
+ * Each half width is reduced by twice the bump distance (as in \c
+ * make_bumper) plus the single-precision rounding of a point inside the box,
+ * and is then rounded toward zero.
+ */
+Array<fast_real_type, 3>
+calc_shrunk_half_widths(BBox const& bbox, Tolerance<> const& tol)
+{
+    CELER_EXPECT(bbox);
+    CELER_EXPECT(tol);
+
+    Array<fast_real_type, 3> result;
+    for (auto ax : range(Axis::size_))
+    {
+        real_type lo = bbox.point(Bound::lo, ax);
+        real_type hi = bbox.point(Bound::hi, ax);
+        real_type hw = (hi - lo) / 2;
+        real_type bump = 2
+                         * celeritas::max(tol.abs,
+                                          tol.rel
+                                              * celeritas::max(std::fabs(lo),
+                                                               std::fabs(hi)));
+        hw -= bump + numeric_limits<fast_real_type>::epsilon() * hw;
+        hw = celeritas::max(hw, real_type{0});
+
+        auto hw_fast = static_cast<fast_real_type>(hw);
+        if (hw_fast > hw)
+        {
+            hw_fast = std::nextafter(hw_fast, fast_real_type{0});
+        }
+        result[to_int(ax)] = hw_fast;
+    }
+    return result;
+}
+
 struct ForceMax
 {
     size_type faces = std::numeric_limits<size_type>::max();
@@ -406,6 +448,7 @@ UnitInserter::UnitInserter(UniverseInserter* insert_universe,
                            ConstructionOptions const* opts)
     : orange_data_(orange_data)
     , build_bvh_tree_{&orange_data_->bvh_tree_data, opts->bvh_options}
+    , build_voxel_grid_{orange_data_, opts->voxel_options}
     , insert_transform_{&orange_data_->transforms, &orange_data_->reals}
     , build_surfaces_{&orange_data_->surface_types,
                       &orange_data_->real_ids,
@@ -552,6 +595,9 @@ UnivId UnitInserter::operator()(UnitInput&& inp)
     }
     unit.bvh_tree = build_bvh_tree_(std::move(bboxes), implicit_vol_ids);
 
+    // Create optional voxel grid
+    unit.voxel_grid = build_voxel_grid_(unit);
+
     // Save connectivity
     {
         std::vector<ConnectivityRecord> conn(connectivity.size());
@@ -688,8 +734,10 @@ void UnitInserter::process_obz_record(
 
     OrientedBoundingZoneRecord obz_record;
 
-    // Set half widths
-    auto inner_hw = calc_half_widths(calc_bumped_(obz_input.inner));
+    // Set half widths: the inner box is shrunk so that its safety distance
+    // is conservative
+    auto inner_hw
+        = calc_shrunk_half_widths(obz_input.inner, orange_data_->scalars.tol);
     auto outer_hw = calc_half_widths(calc_bumped_(obz_input.outer));
     obz_record.half_widths = {inner_hw, outer_hw};
 
@@ -701,7 +749,7 @@ void UnitInserter::process_obz_record(
     obz_record.offset_ids = {inner_offset_id, outer_offset_id};
 
     // Set transformation
-    obz_record.trans_id = obz_input.trans_id;
+    obz_record.trans_id = insert_transform_(obz_input.transform);
 
     // Save the OBZ record to the volume record
     vol_record->obz_id = obz_records_.push_back(obz_record);
@@ -13,6 +13,7 @@
 #include "BvhBuilder.hh"
 #include "SurfacesRecordBuilder.hh"
 #include "TransformRecordInserter.hh"
+#include "VoxelGridBuilder.hh"
 #include "../BoundingBoxUtils.hh"
 #include "../OrangeData.hh"
 #include "../OrangeInput.hh"
@@ -55,6 +56,7 @@ class UnitInserter
   private:
     Data* orange_data_{nullptr};
     BvhBuilder build_bvh_tree_;
+    VoxelGridBuilder build_voxel_grid_;
     TransformRecordInserter insert_transform_;
     SurfacesRecordBuilder build_surfaces_;
     UniverseInserter* insert_universe_;
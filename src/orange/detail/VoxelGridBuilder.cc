@@ -0,0 +1,310 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VoxelGridBuilder.cc
+//---------------------------------------------------------------------------//
+#include "VoxelGridBuilder.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Ref.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "orange/univ/detail/InfixEvaluator.hh"
+#include "orange/univ/detail/LocalVolumeView.hh"
+#include "orange/univ/detail/LogicEvaluator.hh"
+#include "orange/univ/detail/SenseCalculator.hh"
+#include "orange/univ/detail/SurfaceFunctors.hh"
+
+#include "BvhView.hh"
+#include "OrientedBoundingZone.hh"
+#include "VoxelGridView.hh"
+#include "../BoundingBoxUtils.hh"
+#include "../surf/LocalSurfaceVisitor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using Dims = VoxelGridRecord::Dims;
+using LogicEvaluatorT
+    = std::conditional_t<orange_tracking_logic == LogicNotation::infix,
+                         InfixEvaluator,
+                         PostfixEvaluator>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Choose the number of roughly cubic voxels along each axis.
+ */
+Dims calc_dims(Real3 const& width, size_type max_voxels)
+{
+    CELER_EXPECT(max_voxels > 0);
+
+    real_type volume = width[0] * width[1] * width[2];
+    if (!(volume > 0))
+    {
+        // Degenerate extents
+        return {0, 0, 0};
+    }
+
+    // Voxels clamped to a single layer along a thin axis can push the total
+    // over the limit: grow the voxel size until it fits. A small fudge
+    // avoids losing a layer to roundoff when the extents are equal.
+    constexpr real_type fudge = 1e-6;
+    real_type edge = std::cbrt(volume / static_cast<real_type>(max_voxels));
+    Dims result;
+    for (int attempt = 0; attempt < 64; ++attempt)
+    {
+        std::size_t total = 1;
+        for (auto ax : range(3))
+        {
+            result[ax] = static_cast<size_type>(std::max(
+                real_type(1), std::floor(width[ax] / edge + fudge)));
+            total *= result[ax];
+        }
+        if (total <= max_voxels)
+        {
+            return result;
+        }
+        edge *= real_type(1.1);
+    }
+    CELER_ASSERT_UNREACHABLE();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the voxel index range along an axis that overlaps a coordinate range.
+ */
+Array<size_type, 2> calc_index_range(VoxelGridRecord const& grid,
+                                     size_type ax,
+                                     real_type lower,
+                                     real_type upper)
+{
+    auto to_index = [&grid, ax](real_type x) {
+        real_type coord = VoxelGridView::calc_coord(grid, ax, x);
+        coord = clamp(std::floor(coord),
+                      real_type(0),
+                      static_cast<real_type>(grid.dims[ax] - 1));
+        return static_cast<size_type>(coord);
+    };
+    return {to_index(lower), to_index(upper)};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from full parameter data and options.
+ */
+VoxelGridBuilder::VoxelGridBuilder(Data* data, Input const& inp)
+    : data_{data}
+    , inp_{inp}
+    , cells_{&data->voxel_grid_data.cells}
+    , local_volume_ids_{&data->voxel_grid_data.local_volume_ids}
+{
+    CELER_EXPECT(data_);
+    CELER_EXPECT(inp_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build a grid for a unit, returning a null record if disabled.
+ */
+VoxelGridRecord VoxelGridBuilder::operator()(SimpleUnitRecord const& unit)
+{
+    CELER_EXPECT(unit.bvh_tree);
+
+    if (inp_.max_voxels == 0)
+    {
+        return {};
+    }
+
+    Stopwatch get_time;
+    auto const params = make_const_ref(*data_);
+    BvhView const bvh{unit.bvh_tree, params.bvh_tree_data};
+
+    // Gather the volumes stored in the BVH tree
+    std::vector<LocalVolumeId> finite_vols;
+    FastBBox extent;
+    for (auto id : range(LocalVolumeId{unit.volumes.size()}))
+    {
+        LocalVolumeView vol{params, unit, id};
+        FastBBox const& bbox = bvh.bbox(id);
+        if (vol.implicit_vol() || !is_finite(bbox))
+        {
+            continue;
+        }
+        finite_vols.push_back(id);
+        extent = calc_union(extent, bbox);
+    }
+    if (finite_vols.size() < inp_.min_volumes)
+    {
+        return {};
+    }
+
+    ScopedProfiling profile_this{"orange-build-voxel-grid"};
+
+    // Define the grid
+    VoxelGridRecord result;
+    Real3 width;
+    for (auto ax : range(3))
+    {
+        result.lower[ax] = extent.lower()[ax];
+        width[ax] = extent.upper()[ax] - result.lower[ax];
+    }
+    result.dims = calc_dims(width, inp_.max_voxels);
+    if (result.dims[0] == 0)
+    {
+        return {};
+    }
+    for (auto ax : range(3))
+    {
+        result.inv_width[ax] = result.dims[ax] / width[ax];
+    }
+    size_type const num_cells = result.dims[0] * result.dims[1]
+                                * result.dims[2];
+    auto to_index
+        = [&dims = result.dims](size_type i, size_type j, size_type k) {
+              return (i * dims[1] + j) * dims[2] + k;
+          };
+
+    // Add each volume to the voxels overlapping its bounding box
+    std::vector<std::vector<LocalVolumeId>> candidates(num_cells);
+    for (LocalVolumeId id : finite_vols)
+    {
+        FastBBox const& bbox = bvh.bbox(id);
+        Array<Array<size_type, 2>, 3> ranges;
+        for (auto ax : range(3))
+        {
+            ranges[ax] = calc_index_range(
+                result, ax, bbox.lower()[ax], bbox.upper()[ax]);
+        }
+        for (auto i : range(ranges[0][0], ranges[0][1] + 1))
+        {
+            for (auto j : range(ranges[1][0], ranges[1][1] + 1))
+            {
+                for (auto k : range(ranges[2][0], ranges[2][1] + 1))
+                {
+                    candidates[to_index(i, j, k)].push_back(id);
+                }
+            }
+        }
+    }
+
+    // Calculate a conservative safety at the center of a voxel, if the
+    // center is inside the given volume
+    LocalSurfaceVisitor visit_surface(params, unit.surfaces);
+    auto calc_center_safety = [&](LocalVolumeId id, Real3 const& pos) {
+        LocalVolumeView vol{params, unit, id};
+        OnFace on_face;
+        auto calc_senses = SenseCalculator(visit_surface, vol, pos, on_face);
+        if (!LogicEvaluatorT(vol.logic())(calc_senses) || on_face)
+        {
+            return real_type{-1};
+        }
+        if (vol.simple_safety())
+        {
+            real_type safety = numeric_limits<real_type>::infinity();
+            CalcSafetyDistance calc_safety{pos};
+            for (LocalSurfaceId surface : vol.faces())
+            {
+                safety = celeritas::min(safety,
+                                        visit_surface(calc_safety, surface));
+            }
+            // Degenerate points (e.g., a sphere's center) give an infinite
+            // distance, which is not a safe bound
+            return std::isinf(safety) ? 0 : safety;
+        }
+        if (OrientedBoundingZoneId obz_id = vol.obz_id())
+        {
+            OrientedBoundingZone obz{params.obz_records[obz_id],
+                                     {&params.transforms, &params.reals}};
+            if (obz.calc_sense(pos) == SignedSense::inside)
+            {
+                return obz.calc_safety_inside(pos);
+            }
+        }
+        return real_type{0};
+    };
+
+    // Half-diagonal of a voxel, plus a tolerance to account for points
+    // rounded into a neighboring voxel
+    real_type const max_offset = [&] {
+        Real3 half_width;
+        for (auto ax : range(3))
+        {
+            half_width[ax] = real_type(0.5) / result.inv_width[ax];
+        }
+        return norm(half_width) + data_->scalars.tol.abs;
+    }();
+
+    // Find voxels entirely inside a single volume and save the cells
+    std::vector<VoxelCell> cells(num_cells);
+    for (auto i : range(result.dims[0]))
+    {
+        for (auto j : range(result.dims[1]))
+        {
+            for (auto k : range(result.dims[2]))
+            {
+                auto idx = to_index(i, j, k);
+                auto& vols = candidates[idx];
+                Real3 center;
+                Array<size_type, 3> ijk{i, j, k};
+                for (auto ax : range(3))
+                {
+                    center[ax] = result.lower[ax]
+                                 + (ijk[ax] + real_type(0.5))
+                                       / result.inv_width[ax];
+                }
+
+                VoxelCell& cell = cells[idx];
+                for (LocalVolumeId id : vols)
+                {
+                    real_type safety = calc_center_safety(id, center);
+                    if (safety < 0)
+                    {
+                        // Not in this volume
+                        continue;
+                    }
+                    if (safety > max_offset)
+                    {
+                        vols = {id};
+                        cell.safety = safety - max_offset;
+                        ++result.metadata.num_safe_cells;
+                    }
+                    break;
+                }
+                result.metadata.num_candidates += vols.size();
+                cell.vol_ids
+                    = local_volume_ids_.insert_back(vols.begin(), vols.end());
+            }
+        }
+    }
+    result.cells = cells_.insert_back(cells.begin(), cells.end());
+    result.metadata.build_time = get_time();
+
+    CELER_LOG(debug) << "Built " << result.dims[0] << "x" << result.dims[1]
+                     << "x" << result.dims[2] << " voxel grid with "
+                     << result.metadata.num_candidates << " candidates and "
+                     << result.metadata.num_safe_cells << " safe voxels in "
+                     << result.metadata.build_time << " s";
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
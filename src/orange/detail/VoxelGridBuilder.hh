@@ -0,0 +1,64 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VoxelGridBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
+
+#include "VoxelGridData.hh"
+#include "../OrangeData.hh"
+#include "../inp/VoxelGrid.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build a uniform voxel grid over the finite volumes of a unit.
+ *
+ * The grid covers the union of the finite, non-implicit volume bounding boxes
+ * with roughly cubic voxels, using at most \c max_voxels voxels. Each voxel
+ * lists the volumes whose bounding box overlaps it, in the same order the BVH
+ * would test them.
+ *
+ * The voxel center is then located among those candidates, and the safety
+ * distance at the center is calculated with the simple surface algorithm (or
+ * the volume's oriented bounding zone). If that distance exceeds the distance
+ * from the center to the voxel's corners, the entire voxel is inside the
+ * volume: the candidate list is reduced to that volume and the difference is
+ * stored as a lower bound on the safety distance anywhere in the voxel.
+ *
+ * The unit's surfaces, volumes, and BVH must already have been inserted.
+ */
+class VoxelGridBuilder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Data = HostVal<OrangeParamsData>;
+    using Input = inp::VoxelGridBuilder;
+    //!@}
+
+  public:
+    // Construct from full parameter data and options
+    VoxelGridBuilder(Data* data, Input const& inp);
+
+    // Build a grid for a unit, returning a null record if disabled
+    VoxelGridRecord operator()(SimpleUnitRecord const& unit);
+
+  private:
+    Data* data_;
+    Input inp_;
+    CollectionBuilder<VoxelCell> cells_;
+    DedupeCollectionBuilder<LocalVolumeId> local_volume_ids_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
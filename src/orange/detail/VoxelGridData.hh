@@ -0,0 +1,110 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VoxelGridData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+
+#include "../OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Precomputed point location and safety data for a single voxel.
+ *
+ * The candidate volumes are the finite volumes whose bounding boxes overlap
+ * the voxel. If the safety is positive, the voxel is entirely inside the
+ * single candidate volume, and the safety is a lower bound on the distance
+ * from any point in the voxel to that volume's surfaces.
+ */
+struct VoxelCell
+{
+    ItemRange<LocalVolumeId> vol_ids;
+    real_type safety{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Uniform grid of voxels covering the finite volumes of a unit.
+ *
+ * Voxels are indexed in C order (z fastest). Points outside the grid, and
+ * volumes with infinite bounding boxes, are handled by the BVH.
+ */
+struct VoxelGridRecord
+{
+    //// TYPES ////
+
+    using Dims = Array<size_type, 3>;
+
+    struct Metadata
+    {
+        //! Total number of candidate volumes over all voxels
+        size_type num_candidates{};
+        //! Number of voxels with a known volume and safety
+        size_type num_safe_cells{};
+        //! Wall time to build the grid [s]
+        real_type build_time{};
+    };
+
+    //// DATA ////
+
+    //! Number of voxels along each axis
+    Dims dims{0, 0, 0};
+    //! Lower corner of the grid
+    Real3 lower{0, 0, 0};
+    //! Inverse of the voxel width along each axis
+    Real3 inv_width{0, 0, 0};
+
+    //! Voxel data
+    ItemRange<VoxelCell> cells;
+
+    //! The metadata for this grid
+    Metadata metadata;
+
+    //// METHODS ////
+
+    //! Whether a grid is present
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !cells.empty()
+               && cells.size() == dims[0] * dims[1] * dims[2];
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent data used by all voxel grids.
+ *
+ * Grids are optional, so these may be empty.
+ */
+template<Ownership W, MemSpace M>
+struct VoxelGridData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    // Low-level storage
+    Items<VoxelCell> cells;
+    Items<LocalVolumeId> local_volume_ids;
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    VoxelGridData& operator=(VoxelGridData<W2, M2> const& other)
+    {
+        cells = other.cells;
+        local_volume_ids = other.local_volume_ids;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,131 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VoxelGridView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/cont/LdgSpan.hh"
+#include "corecel/data/Collection.hh"
+#include "orange/OrangeTypes.hh"
+
+#include "VoxelGridData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Access a unit's voxel grid.
+ *
+ * The voxel coordinate calculation is shared with the grid builder so that a
+ * point inside a (bumped) volume bounding box always maps to a voxel that
+ * lists the volume as a candidate.
+ */
+class VoxelGridView
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Storage = NativeCRef<VoxelGridData>;
+    using CellId = ItemId<VoxelCell>;
+    using SpanLocalVol = LdgSpan<LocalVolumeId const>;
+    //!@}
+
+  public:
+    // Construct from grid record and shared storage
+    inline CELER_FUNCTION
+    VoxelGridView(VoxelGridRecord const& grid, Storage const& storage);
+
+    // Calculate the fractional voxel coordinate along an axis
+    static inline CELER_FUNCTION real_type
+    calc_coord(VoxelGridRecord const& grid, size_type ax, real_type x);
+
+    // Find the voxel containing a point, if inside the grid
+    inline CELER_FUNCTION CellId find(Real3 const& pos) const;
+
+    // Get the candidate volumes in a voxel
+    inline CELER_FUNCTION SpanLocalVol vol_ids(CellId id) const;
+
+    // Get the lower bound on the safety distance in a voxel
+    inline CELER_FUNCTION real_type safety(CellId id) const;
+
+  private:
+    VoxelGridRecord const& grid_;
+    Storage const& storage_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from grid record and shared storage.
+ */
+CELER_FUNCTION
+VoxelGridView::VoxelGridView(VoxelGridRecord const& grid,
+                             Storage const& storage)
+    : grid_{grid}, storage_{storage}
+{
+    CELER_EXPECT(grid_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the fractional voxel coordinate along an axis.
+ */
+CELER_FUNCTION real_type VoxelGridView::calc_coord(VoxelGridRecord const& grid,
+                                                   size_type ax,
+                                                   real_type x)
+{
+    return (x - grid.lower[ax]) * grid.inv_width[ax];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the voxel containing a point, if inside the grid.
+ */
+CELER_FUNCTION auto VoxelGridView::find(Real3 const& pos) const -> CellId
+{
+    size_type index = 0;
+    for (size_type ax = 0; ax != 3; ++ax)
+    {
+        real_type coord = calc_coord(grid_, ax, pos[ax]);
+        if (!(coord >= 0 && coord < static_cast<real_type>(grid_.dims[ax])))
+        {
+            // Outside the grid (or NaN)
+            return {};
+        }
+        index = index * grid_.dims[ax] + static_cast<size_type>(coord);
+    }
+    CELER_ASSERT(index < grid_.cells.size());
+    return grid_.cells[index];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the candidate volumes in a voxel.
+ */
+CELER_FUNCTION auto VoxelGridView::vol_ids(CellId id) const -> SpanLocalVol
+{
+    CELER_EXPECT(id < storage_.cells.size());
+    return storage_.local_volume_ids[storage_.cells[id].vol_ids];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the lower bound on the safety distance in a voxel.
+ *
+ * A positive value means the voxel is entirely inside its single candidate
+ * volume.
+ */
+CELER_FUNCTION real_type VoxelGridView::safety(CellId id) const
+{
+    CELER_EXPECT(id < storage_.cells.size());
+    return storage_.cells[id].safety;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -11,6 +11,7 @@
 #include <variant>
 
 #include "corecel/io/Logger.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "geocel/GeantGeoParams.hh"
 #include "geocel/Types.hh"
 #include "geocel/VolumeParams.hh"
@@ -94,7 +95,10 @@ auto Converter::operator()(GeantGeoParams const& geo,
                    << "world volume should not have a transformation");
 
     // Convert logical volumes into protos
-    auto global_proto = ProtoConstructor{volumes, opts_}(*world.lv);
+    auto global_proto = [&] {
+        ScopedSetupPhase record_phase{"g4org-build-protos"};
+        return ProtoConstructor{volumes, opts_}(*world.lv);
+    }();
 
     // Build universes from protos
     result_type result;
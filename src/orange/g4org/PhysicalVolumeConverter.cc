@@ -18,7 +18,7 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StreamableVariant.hh"
-#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
 #include "corecel/sys/TypeDemangler.hh"
 #include "geocel/GeantGeoParams.hh"
 #include "orange/inp/Import.hh"
@@ -128,7 +128,7 @@ PhysicalVolumeConverter::~PhysicalVolumeConverter() = default;
 //---------------------------------------------------------------------------//
 auto PhysicalVolumeConverter::operator()(arg_type g4world) -> result_type
 {
-    ScopedProfiling profile_this{"g4org-convert"};
+    ScopedSetupPhase record_phase{"g4org-convert"};
 
     CELER_LOG(status) << "Converting Geant4 geometry elements to ORANGE input";
 
@@ -30,10 +30,16 @@ struct BvhBuilder
     //! a node during BVH construction
     size_type num_part_cands = 3;
 
+    //! Maximum number of children tested together per internal node during
+    //! traversal: 2 is a binary tree, and larger values (up to
+    //! max_bvh_width) collapse the binary tree into a wide tree
+    size_type width = 2;
+
     //! Whether the options are valid
     explicit operator bool() const
     {
-        return max_leaf_size >= 1 && depth_limit >= 1 && num_part_cands >= 1;
+        return max_leaf_size >= 1 && depth_limit >= 1 && num_part_cands >= 1
+               && width >= 2;
     }
 };
 
@@ -0,0 +1,38 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/inp/VoxelGrid.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+namespace inp
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construction options for the optional per-unit voxel grid.
+ *
+ * The grid is disabled by default. When enabled, units with at least \c
+ * min_volumes finite volumes are covered by a uniform grid of roughly cubic
+ * voxels, each storing its candidate volumes and a lower bound on the safety
+ * distance.
+ */
+struct VoxelGridBuilder
+{
+    //! Maximum number of voxels per unit (zero to disable)
+    size_type max_voxels = 0;
+
+    //! Minimum number of finite volumes in a unit to build a grid
+    size_type min_volumes = 64;
+
+    //! Whether the options are valid
+    explicit operator bool() const { return min_volumes >= 1; }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace inp
+}  // namespace celeritas
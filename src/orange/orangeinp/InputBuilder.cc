@@ -13,7 +13,10 @@
 #include "corecel/io/JsonPimpl.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/Environment.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/SetupProfiler.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "corecel/sys/TraceCounter.hh"
 
 #include "ProtoInterface.hh"
@@ -107,7 +110,7 @@ InputBuilder::InputBuilder(Input&& inp) : opts_{std::move(inp)}
  */
 auto InputBuilder::operator()(ProtoInterface const& global) const -> result_type
 {
-    ScopedProfiling profile_this{"orangeinp-build"};
+    ScopedSetupPhase record_phase{"orangeinp-build"};
     CELER_LOG(status) << "Constructing ORANGE surfaces and runtime data";
 
     // Construct the hierarchy of protos
@@ -122,25 +125,40 @@ auto InputBuilder::operator()(ProtoInterface const& global) const -> result_type
     OrangeInput result;
     result.tol = opts_.tol;
     result.logic = opts_.logic;
+    result.universes.resize(protos.size());
+    result.build_times.resize(protos.size());
     JsonCsgOutput csg_outp;
-    detail::ProtoBuilder builder(&result, protos, [&] {
-        detail::ProtoBuilder::Options pbopts;
-        if (!opts_.csg_output_file.empty())
-        {
-            csg_outp = JsonCsgOutput{protos.size()};
-            pbopts.save_json = std::ref(csg_outp);
-        }
-        pbopts.implicit_parent_boundary = opts_.implicit_parent_boundary;
-        return pbopts;
-    }());
-
-    // Build protos in reverse order, i.e., starting with child protos
-    for (auto i : range<int>(protos.size()).step(-1))
+    detail::ProtoBuilder::Options pbopts;
+    if (!opts_.csg_output_file.empty())
     {
-        UnivId univ_id{static_cast<size_type>(i)};
+        csg_outp = JsonCsgOutput{protos.size()};
+        pbopts.save_json = std::ref(csg_outp);
+    }
+    pbopts.implicit_parent_boundary = opts_.implicit_parent_boundary;
+
+    // Build protos concurrently: each universe depends only on the proto map
+    // and writes to its own output slot, so the result is deterministic.
+    // Dynamic scheduling balances the very uneven cost of different units.
+    auto build_universe = [&](UnivId univ_id) {
         trace_counter("orange-build-universe", univ_id.get());
+        Stopwatch get_time;
+        detail::ProtoBuilder builder(&result, protos, pbopts, univ_id);
         protos.at(univ_id)->build(builder);
+        result.build_times[univ_id.get()] = get_time();
+    };
+
+    MultiExceptionHandler capture_exception;
+    size_type const num_protos = protos.size();
+#ifdef _OPENMP
+#    pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_type i = 0; i < num_protos; ++i)
+    {
+        // Start with the last (usually most deeply nested) protos
+        CELER_TRY_HANDLE(build_universe(UnivId{num_protos - 1 - i}),
+                         capture_exception);
     }
+    log_and_rethrow(std::move(capture_exception));
 
     if (csg_outp)
     {
@@ -168,6 +186,18 @@ auto InputBuilder::operator()(ProtoInterface const& global) const -> result_type
         result.construction_opts.bvh_options.num_part_cands = dl;
     }
 
+    if (std::string var = celeritas::getenv("ORANGE_BVH_WIDTH"); !var.empty())
+    {
+        size_type w = std::stoul(var);
+        result.construction_opts.bvh_options.width = w;
+    }
+
+    if (std::string var = celeritas::getenv("ORANGE_VOXEL_GRID"); !var.empty())
+    {
+        size_type nv = std::stoul(var);
+        result.construction_opts.voxel_options.max_voxels = nv;
+    }
+
     CELER_ENSURE(result);
     return result;
 }
@@ -380,10 +380,15 @@ void UnitProto::build(ProtoBuilder& pb) const
         CELER_ASSERT(region_iter != csg_unit.regions.end());
         vi.bbox = get_exterior_bbox(region_iter->second.bounds);
 
-        // Set bounding zone
-        vi.obz.inner = region_iter->second.bounds.interior;
-        vi.obz.outer = region_iter->second.bounds.exterior;
-        vi.obz.trans_id = region_iter->second.trans_id;
+        // Set bounding zone if the region is known to enclose a finite box.
+        // Region bounds are already in the unit's reference frame.
+        if (auto const& bz = region_iter->second.bounds;
+            !bz.negated && bz.interior && is_finite(bz.interior)
+            && is_finite(bz.exterior))
+        {
+            vi.obz.inner = bz.interior;
+            vi.obz.outer = bz.exterior;
+        }
 
         /*!
          * \todo "simple safety" flag is set inside "unit inserter": move here
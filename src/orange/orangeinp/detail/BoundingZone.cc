@@ -56,13 +56,9 @@ BBox calc_difference(BBox const& a, BBox const& b, Zone which)
     {
         if (encloses(b, a))
         {
-            if (encloses(a, b))
-            {
-                // Edge case: a == b
-                return a;
-            }
-
-            // The two "known inside" regions do not overlap: exactly null
+            // The two "known inside" regions do not overlap: exactly null.
+            // This includes the edge case a == b: every point inside a may be
+            // inside the subtracted region, so no interior point is known.
             return {};
         }
         // Irregular region: conservatively return null
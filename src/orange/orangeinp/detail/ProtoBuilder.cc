@@ -19,19 +19,24 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with output pointer, geometry construction options, and protos.
+ * Construct with output, protos, options, and the universe to build.
+ *
+ * The output universes must already be sized to the number of protos.
  */
-ProtoBuilder::ProtoBuilder(
-    OrangeInput* inp, ProtoMap const& protos, Options const& opts)
+ProtoBuilder::ProtoBuilder(OrangeInput* inp,
+                           ProtoMap const& protos,
+                           Options const& opts,
+                           UnivId univ_id)
     : inp_{inp}
     , protos_{protos}
     , save_json_{opts.save_json}
     , implicit_parent_boundary_{opts.implicit_parent_boundary}
+    , univ_id_{univ_id}
 {
     CELER_EXPECT(inp_);
     CELER_EXPECT(inp_->logic != LogicNotation::size_);
-    inp_->universes.resize(protos_.size());
-    CELER_ENSURE(this->num_universes() == protos.size());
+    CELER_EXPECT(this->num_universes() == protos.size());
+    CELER_EXPECT(univ_id_ < this->num_universes());
 }
 
 //---------------------------------------------------------------------------//
@@ -52,12 +57,7 @@ void ProtoBuilder::save_json(JsonPimpl&& jp) const
  */
 void ProtoBuilder::insert(VariantUniverseInput&& unit)
 {
-    inp_->universes[this->current_uid().get()] = std::move(unit);
-
-    if (!this->is_global_universe())
-    {
-        ++num_univs_inserted_;
-    }
+    inp_->universes[univ_id_.get()] = std::move(unit);
 }
 
 //---------------------------------------------------------------------------//
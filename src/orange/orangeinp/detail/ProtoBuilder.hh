@@ -27,8 +27,9 @@ namespace detail
  * Manage data and state during the universe construction.
  *
  * This is a helper class passed to UnitProto::build which manages data for the
- * UnitProto -> OrangeInput build process. It also maintains the universe ID
- * of the current universe being constructed.
+ * UnitProto -> OrangeInput build process. One builder is created for each
+ * universe, so that independent universes can be built concurrently: each
+ * writes only to its own preallocated entry in the output universes.
  */
 class ProtoBuilder
 {
@@ -50,8 +51,11 @@ class ProtoBuilder
     };
 
   public:
-    // Construct with output pointer, geometry construction options, and protos
-    ProtoBuilder(OrangeInput* inp, ProtoMap const& protos, Options const& opts);
+    // Construct with output, protos, options, and the universe to build
+    ProtoBuilder(OrangeInput* inp,
+                 ProtoMap const& protos,
+                 Options const& opts,
+                 UnivId univ_id);
 
     //! Get the tolerance to use when constructing geometry
     Tol const& tol() const { return inp_->tol; }
@@ -62,8 +66,8 @@ class ProtoBuilder
     // Find a universe ID
     inline UnivId find_universe_id(ProtoInterface const*) const;
 
-    // Get the UniverseId of the universe currently being built
-    inline UnivId current_uid() const;
+    //! Get the UniverseId of the universe currently being built
+    UnivId current_uid() const { return univ_id_; }
 
     //! Number of universes
     UnivId::size_type num_universes() const { return inp_->universes.size(); }
@@ -95,8 +99,7 @@ class ProtoBuilder
     SaveUnivJson save_json_;
     bool implicit_parent_boundary_{};
 
-    // State variables
-    size_type num_univs_inserted_{0};
+    UnivId univ_id_;
 };
 
 //---------------------------------------------------------------------------//
@@ -110,16 +113,6 @@ UnivId ProtoBuilder::find_universe_id(ProtoInterface const* p) const
     return protos_.find(p);
 }
 
-//---------------------------------------------------------------------------//
-/*!
- * Get the UniverseId of the universe currently being built.
- */
-UnivId ProtoBuilder::current_uid() const
-{
-    CELER_EXPECT(num_univs_inserted_ < this->num_universes());
-    return UnivId{this->num_universes() - num_univs_inserted_ - 1};
-}
-
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace orangeinp
@@ -14,6 +14,9 @@
 #include "orange/SenseUtils.hh"
 #include "orange/detail/BvhEnclosingVolFinder.hh"
 #include "orange/detail/BvhIntersectingVolFinder.hh"
+#include "orange/detail/BvhView.hh"
+#include "orange/detail/OrientedBoundingZone.hh"
+#include "orange/detail/VoxelGridView.hh"
 #include "orange/surf/LocalSurfaceVisitor.hh"
 
 #include "detail/InfixEvaluator.hh"
@@ -377,21 +380,54 @@ CELER_FUNCTION auto SimpleUnitTracker::intersect(
  *
  * The safety calculation uses a very limited method for calculating the safety
  * distance: it's the nearest distance to any surface, for a certain subset of
- * surfaces.  Other surface types will return a safety distance of zero.
- * Complex surfaces might return the distance to internal surfaces that do not
- * represent the edge of a volume. Such distances are conservative but will
- * necessarily slow down the simulation.
+ * surfaces.  Complex surfaces might return the distance to internal surfaces
+ * that do not represent the edge of a volume. Such distances are conservative
+ * but will necessarily slow down the simulation.
+ *
+ * Volumes with other surface types fall back to their oriented bounding zone
+ * if one was constructed: the distance to the edge of the inner box, which is
+ * fully enclosed by the volume, is a lower bound on the true safety. Points
+ * outside the inner box (or in volumes without a bounding zone) return a
+ * safety distance of zero.
+ *
+ * If the unit has a voxel grid and the point is in a voxel known to be
+ * entirely inside the volume, the voxel's precomputed lower bound is returned
+ * without looping over the faces.
  */
 CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
                                                    LocalVolumeId vol_id) const
 {
     CELER_EXPECT(vol_id);
 
+    if (unit_record_.voxel_grid)
+    {
+        detail::VoxelGridView grid{unit_record_.voxel_grid,
+                                   params_.voxel_grid_data};
+        if (auto cell = grid.find(pos))
+        {
+            real_type result = grid.safety(cell);
+            if (result > 0 && grid.vol_ids(cell)[0] == vol_id)
+            {
+                return result;
+            }
+        }
+    }
+
     VolumeView vol = this->make_local_volume(vol_id);
     if (!vol.simple_safety())
     {
         // Has a tricky surface: we can't use the simple algorithm to calculate
         // the safety, so return a conservative estimate.
+        if (OrientedBoundingZoneId obz_id = vol.obz_id())
+        {
+            detail::OrientedBoundingZone obz{
+                params_.obz_records[obz_id],
+                {&params_.transforms, &params_.reals}};
+            if (obz.calc_sense(pos) == SignedSense::inside)
+            {
+                return obz.calc_safety_inside(pos);
+            }
+        }
         return 0;
     }
 
@@ -449,6 +485,33 @@ template<class F>
 CELER_FUNCTION LocalVolumeId SimpleUnitTracker::find_volume_where(
     Real3 const& pos, F&& predicate) const
 {
+    if (unit_record_.voxel_grid)
+    {
+        detail::VoxelGridView grid{unit_record_.voxel_grid,
+                                   params_.voxel_grid_data};
+        if (auto cell = grid.find(pos))
+        {
+            // Test the finite volumes overlapping this voxel, then fall back
+            // to the volumes outside the BVH tree
+            for (LocalVolumeId id : grid.vol_ids(cell))
+            {
+                if (predicate(id))
+                {
+                    return id;
+                }
+            }
+            detail::BvhView bvh{unit_record_.bvh_tree, params_.bvh_tree_data};
+            for (LocalVolumeId id : bvh.inf_vol_ids())
+            {
+                if (predicate(id))
+                {
+                    return id;
+                }
+            }
+            return {};
+        }
+    }
+
     detail::BvhEnclosingVolFinder find_volume{unit_record_.bvh_tree,
                                               params_.bvh_tree_data};
     return find_volume(pos, predicate);
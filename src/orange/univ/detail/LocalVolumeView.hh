@@ -82,6 +82,9 @@ class LocalVolumeView
     // Whether the intersection is the closest interior surface
     CELER_FORCEINLINE_FUNCTION bool simple_intersection() const;
 
+    // Get the oriented bounding zone, if any
+    CELER_FORCEINLINE_FUNCTION OrientedBoundingZoneId obz_id() const;
+
   private:
     ParamsRef const& params_;
     LocalVolumeRecord const& def_;
@@ -221,6 +224,15 @@ CELER_FUNCTION bool LocalVolumeView::simple_intersection() const
                 | LocalVolumeRecord::implicit_vol));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the oriented bounding zone, if any.
+ */
+CELER_FUNCTION OrientedBoundingZoneId LocalVolumeView::obz_id() const
+{
+    return def_.obz_id;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the volume record data for the current volume.
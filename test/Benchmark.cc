@@ -0,0 +1,102 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Benchmark.cc
+//---------------------------------------------------------------------------//
+#include "Benchmark.hh"
+
+#include <fstream>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/Config.hh"
+#include "corecel/Version.hh"
+#include "corecel/sys/Environment.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <sys/resource.h>
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the peak resident memory of this process [MiB].
+ *
+ * This returns zero on platforms without \c getrusage .
+ */
+double peak_memory_mib()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#    ifdef __APPLE__
+        // Reported in bytes
+        return static_cast<double>(usage.ru_maxrss) / (1024 * 1024);
+#    else
+        // Reported in KiB
+        return static_cast<double>(usage.ru_maxrss) / 1024;
+#    endif
+    }
+#endif
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a benchmark result as JSON for the current test.
+ *
+ * If the \c CELER_BENCH_DIR environment variable is set, the result is written
+ * to \c {suite}.{test}.json in that directory so that results can be collected
+ * and compared between releases. Otherwise it is printed to stdout.
+ */
+void write_benchmark(BenchmarkResult const& result)
+{
+    ::testing::TestInfo const* const test_info
+        = ::testing::UnitTest::GetInstance()->current_test_info();
+    CELER_ASSERT(test_info);
+    std::string name = test_info->test_suite_name();
+    name += '.';
+    name += test_info->name();
+
+    nlohmann::json j = {
+        {"name", name},
+        {"version", std::string(version_string)},
+        {"build_type", std::string(cmake::build_type)},
+        {"core_geo", std::string(cmake::core_geo)},
+        {"openmp", std::string(cmake::openmp)},
+        {"real_type", std::string(cmake::real_type)},
+        {"metrics", result.metrics},
+    };
+    if (!result.action_times.empty())
+    {
+        j["action_times"] = result.action_times;
+    }
+    if (!result.step_times.empty())
+    {
+        j["step_times"] = result.step_times;
+    }
+
+    std::string const& dirname = celeritas::getenv("CELER_BENCH_DIR");
+    if (dirname.empty())
+    {
+        std::cout << j.dump() << std::endl;
+        return;
+    }
+
+    std::string filename = dirname + "/" + name + ".json";
+    std::ofstream out(filename);
+    CELER_VALIDATE(out, << "failed to open benchmark output '" << filename
+                        << "'");
+    out << j.dump(1) << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,70 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Benchmark.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Stopwatch.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Machine-readable result of a single benchmark.
+ *
+ * Metrics are named scalar values such as \c "time" [s], \c "steps_per_sec",
+ * or \c "ns_per_call" . Action and step times are only set by benchmarks that
+ * run a full stepping loop.
+ */
+struct BenchmarkResult
+{
+    std::map<std::string, double> metrics;
+    std::map<std::string, double> action_times;
+    std::vector<double> step_times;
+};
+
+// Get the peak resident memory of this process [MiB]
+double peak_memory_mib();
+
+// Write a benchmark result as JSON for the current test
+void write_benchmark(BenchmarkResult const& result);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time repeated calls to a function that returns a floating point value.
+ *
+ * The returned values are accumulated into a volatile sink so that the calls
+ * can't be optimized away. The result is the mean wall time per call [ns].
+ */
+template<class F>
+double time_per_call(F&& func, size_type num_calls)
+{
+    CELER_EXPECT(num_calls > 0);
+
+    double accum{0};
+    Stopwatch get_time;
+    for (size_type i = 0; i < num_calls; ++i)
+    {
+        accum += static_cast<double>(func());
+    }
+    double elapsed = get_time();
+
+    [[maybe_unused]] static double volatile sink;
+    sink = accum;
+
+    return 1e9 * elapsed / static_cast<double>(num_calls);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,214 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/bench/Kernels.test.cc
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/random/distribution/UniformRealDistribution.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/CoreGeoTestBase.hh"
+#include "celeritas/em/distribution/UrbanLargeAngleDistribution.hh"
+#include "celeritas/em/msc/detail/MscStepToGeo.hh"
+#include "celeritas/em/msc/detail/UrbanMscHelper.hh"
+#include "celeritas/em/msc/detail/UrbanMscScatter.hh"
+#include "celeritas/em/params/UrbanMscParams.hh"
+#include "celeritas/field/DormandPrinceIntegrator.hh"
+#include "celeritas/field/FieldDriverOptions.hh"
+#include "celeritas/field/MakeMagFieldPropagator.hh"
+#include "celeritas/field/UniformZField.hh"
+#include "celeritas/geo/CoreGeoTrackView.hh"
+#include "celeritas/grid/XsCalculator.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Interaction.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+
+#include "Benchmark.hh"
+#include "celeritas_test.hh"
+#include "../em/MscTestBase.hh"
+#include "../field/FieldTestBase.hh"
+#include "../grid/CalculatorTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time a kernel and write the per-call result.
+ */
+template<class F>
+BenchmarkResult bench_kernel(F&& func, size_type num_calls)
+{
+    BenchmarkResult result;
+    result.metrics = {
+        {"num_calls", num_calls},
+        {"ns_per_call", time_per_call(std::forward<F>(func), num_calls)},
+    };
+    write_benchmark(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// XS CALCULATOR
+//---------------------------------------------------------------------------//
+
+class XsCalculatorBench : public CalculatorTestBase
+{
+};
+
+TEST_F(XsCalculatorBench, random_energy)
+{
+    using Energy = XsCalculator::Energy;
+
+    // Log grid from 1 keV to 100 GeV with a 1/E-scaled upper grid
+    auto xs = [](real_type e) { return 1 + std::sqrt(e); };
+    inp::XsGrid grid;
+    grid.lower.x = {1e-3, 1};
+    grid.upper.x = {1, 1e5};
+    for (auto i : range(49))
+    {
+        grid.lower.y.push_back(xs(std::pow(real_type{10}, -3 + i / 16.0)));
+    }
+    for (auto i : range(81))
+    {
+        real_type e = std::pow(real_type{10}, i / 16.0);
+        grid.upper.y.push_back(xs(e) * e);
+    }
+    this->build(grid);
+
+    std::mt19937 rng;
+    UniformRealDistribution<real_type> sample_loge{std::log(1e-3_r),
+                                                   std::log(1e5_r)};
+    std::vector<Energy> energies(4096);
+    for (auto& e : energies)
+    {
+        e = Energy{std::exp(sample_loge(rng))};
+    }
+
+    XsCalculator calc_xs(this->xs_grid(), this->values());
+    size_type i = 0;
+    auto result = bench_kernel(
+        [&] { return calc_xs(energies[i++ % energies.size()]); }, 1000000);
+    EXPECT_GT(result.metrics["ns_per_call"], 0);
+}
+
+//---------------------------------------------------------------------------//
+// URBAN MSC
+//---------------------------------------------------------------------------//
+
+TEST(UrbanLargeAngleBench, sample)
+{
+    std::mt19937 rng;
+    UrbanLargeAngleDistribution sample_mu{0.5};
+    auto result = bench_kernel([&] { return sample_mu(rng); }, 1000000);
+    EXPECT_GT(result.metrics["ns_per_call"], 0);
+}
+
+#define UrbanMscBench TEST_IF_CELERITAS_USE_ROOT(UrbanMscBench)
+class UrbanMscBench : public MscTestBase
+{
+  protected:
+    void SetUp() override
+    {
+        msc_params_ = UrbanMscParams::from_import(
+            *this->particle(), *this->material(), this->imported_data());
+        ASSERT_TRUE(msc_params_);
+    }
+
+    std::shared_ptr<UrbanMscParams const> msc_params_;
+};
+
+TEST_F(UrbanMscBench, scatter)
+{
+    using namespace celeritas::detail;
+
+    auto const& msc_params = msc_params_->host_ref();
+
+    // 10 MeV electron taking a half-range step near a boundary in steel
+    auto par = this->make_par_view(pdg::electron(), MevEnergy{10});
+    auto phys = this->make_phys_view(
+        par, "G4_STAINLESS-STEEL", this->physics()->host_ref());
+    auto geo = this->make_geo_view(from_cm(1 - 1e-4_r));
+    MaterialView mat = this->material()->get(phys.material_id());
+
+    UrbanMscHelper helper(msc_params, par, phys);
+    MscStep step;
+    step.true_path = phys.dedx_range() / 2;
+    step.is_displaced = true;
+    {
+        MscStepToGeo calc_geom_path(msc_params,
+                                    helper,
+                                    par.energy(),
+                                    helper.msc_mfp(),
+                                    phys.dedx_range());
+        auto gp = calc_geom_path(step.true_path);
+        step.geom_path = gp.step;
+        step.alpha = gp.alpha;
+    }
+    real_type const safety = helper.msc_mfp() / 2;
+
+    UrbanMscScatter scatter(
+        msc_params, helper, par, phys, mat, geo.dir(), safety, step);
+    auto& rng = this->rng();
+    auto result
+        = bench_kernel([&] { return scatter(rng).direction[2]; }, 100000);
+    EXPECT_GT(result.metrics["ns_per_call"], 0);
+}
+
+//---------------------------------------------------------------------------//
+// FIELD PROPAGATOR
+//---------------------------------------------------------------------------//
+
+class FieldPropagatorBench : public CoreGeoTestBase, public FieldTestBase
+{
+  protected:
+    std::string_view gdml_basename() const override { return "two-boxes"; }
+
+    SPConstParticle build_particle() const final
+    {
+        using namespace constants;
+        using namespace units;
+        ParticleParams::Input defs = {{"electron",
+                                       pdg::electron(),
+                                       MevMass{0.5109989461},
+                                       ElementaryCharge{-1},
+                                       stable_decay_constant}};
+        return std::make_shared<ParticleParams>(std::move(defs));
+    }
+};
+
+TEST_F(FieldPropagatorBench, electron_interior)
+{
+    // Circular orbit of radius ~3.8 cm that stays inside the inner box
+    real_type const radius{3.8085385437789383};
+    auto particle
+        = this->make_particle_view(pdg::electron(), MevEnergy{10.9181415106});
+    auto wrapped = this->make_geo_track_view({radius, 0, 0}, {0, 1, 0});
+    auto& geo = wrapped.track_view();
+    UniformZField field(1.0 * units::tesla);
+
+    auto integrate = make_mag_field_integrator<DormandPrinceIntegrator>(
+        field, particle.charge());
+    FieldDriverOptions driver_options;
+    auto propagate
+        = make_field_propagator(integrate, driver_options, particle, geo);
+
+    real_type const step = from_cm(0.5 * constants::pi * radius / 25);
+    auto result = bench_kernel([&] { return propagate(step).distance; },
+                               100000);
+    EXPECT_FALSE(geo.is_outside());
+    EXPECT_GT(result.metrics["ns_per_call"], 0);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
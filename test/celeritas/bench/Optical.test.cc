@@ -0,0 +1,106 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/bench/Optical.test.cc
+//---------------------------------------------------------------------------//
+#include <utility>
+
+#include "corecel/Types.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/inp/StandaloneInput.hh"
+#include "celeritas/optical/Runner.hh"
+
+#include "Benchmark.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST FIXTURES
+//---------------------------------------------------------------------------//
+/*!
+ * Optical-only transport of monoenergetic photons in a liquid argon sphere.
+ *
+ * Since the optical runner sets up Geant4, each benchmark must run in a
+ * separate process.
+ */
+class LArSphereBench : public Test
+{
+  public:
+    void SetUp() override
+    {
+        osi_.problem.model.geometry
+            = Test::test_data_path("geocel", "lar-sphere.gdml");
+        osi_.problem.capacity = [] {
+            inp::OpticalStateCapacity cap;
+            cap.tracks = 16384;
+            cap.primaries = 8 * *cap.tracks;
+            cap.generators = 2 * *cap.tracks;
+            return cap;
+        }();
+        osi_.problem.num_streams = 1;
+        osi_.problem.timers.action = true;
+        osi_.problem.timers.step = true;
+
+        // Only absorption and boundary processes are enabled
+        osi_.geant_setup = [] {
+            GeantOpticalPhysicsOptions opt;
+            opt.cherenkov = std::nullopt;
+            opt.scintillation = std::nullopt;
+            opt.wavelength_shifting = std::nullopt;
+            opt.wavelength_shifting2 = std::nullopt;
+            opt.rayleigh_scattering = false;
+            opt.mie_scattering = false;
+            return opt;
+        }();
+    }
+
+  protected:
+    inp::OpticalStandaloneInput osi_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(LArSphereBench, primary)
+{
+    osi_.problem.generator = [] {
+        inp::OpticalPrimaryGenerator gen;
+        gen.primaries = 65536;
+        gen.energy = inp::MonoenergeticDistribution{1e-5};
+        gen.angle = inp::IsotropicDistribution{};
+        gen.shape = inp::PointDistribution{{0, 0, 0}};
+        return gen;
+    }();
+
+    optical::Runner run(std::move(osi_));
+    run.insert();
+    Stopwatch get_time;
+    auto run_result = run();
+    double const time = get_time();
+
+    auto const& counters = run_result.counters;
+    BenchmarkResult result;
+    result.metrics = {
+        {"num_primaries", 65536},
+        {"num_steps", counters.steps},
+        {"num_step_iters", counters.step_iters},
+        {"time", time},
+        {"steps_per_sec", time > 0 ? counters.steps / time : 0},
+        {"peak_memory_mib", peak_memory_mib()},
+    };
+    result.action_times.insert(run_result.action_times.begin(),
+                               run_result.action_times.end());
+    result.step_times = std::move(run_result.step_times);
+    write_benchmark(result);
+
+    EXPECT_GT(counters.steps, 0u);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,256 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/bench/Stepping.test.cc
+//---------------------------------------------------------------------------//
+#include <memory>
+#include <random>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/LogContextException.hh"
+#include "corecel/random/distribution/IsotropicDistribution.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/SimpleCmsTestBase.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/TestEm3Base.hh"
+#include "celeritas/global/ActionSequence.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/global/StepperTestBase.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/user/ActionTimes.hh"
+#include "celeritas/user/StepTimes.hh"
+
+#include "Benchmark.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Time a fixed-seed problem through the host stepping loop.
+ *
+ * Action and step timers are added to the action sequence, and the result is
+ * written with \c write_benchmark .
+ */
+class SteppingBenchBase : public StepperTestBase
+{
+  public:
+    BenchmarkResult run_bench(size_type num_tracks,
+                              size_type num_primaries,
+                              StateLayout layout = StateLayout::soa);
+};
+
+//---------------------------------------------------------------------------//
+BenchmarkResult SteppingBenchBase::run_bench(size_type num_tracks,
+                                             size_type num_primaries,
+                                             StateLayout layout)
+{
+    // Build core params so that all actions are registered before timing
+    this->core();
+    auto inp = this->make_stepper_input(num_tracks);
+    inp.layout = layout;
+    inp.actions = [this] {
+        ActionSequence::Options opts;
+        opts.action_times = ActionTimes::make_and_insert(
+            this->action_reg(), this->aux_reg(), "action-times");
+        opts.step_times
+            = StepTimes::make_and_insert(this->aux_reg(), "step-times");
+        return std::make_shared<ActionSequence>(*this->action_reg(), opts);
+    }();
+
+    Stepper<MemSpace::host> step(std::move(inp));
+    step.warm_up();
+
+    auto primaries = this->make_primaries(num_primaries);
+    for (auto i : range(primaries.size()))
+    {
+        primaries[i].primary_id = id_cast<PrimaryId>(i);
+    }
+
+    size_type const max_steps = this->max_average_steps() * num_primaries;
+    size_type accum_steps{0};
+    size_type num_iters{0};
+
+    Stopwatch get_time;
+    StepperResult counts;
+    CELER_TRY_HANDLE(counts = step(make_span(primaries)),
+                     LogContextException{this->output_reg().get()});
+    do
+    {
+        accum_steps += counts.active;
+        ++num_iters;
+        if (!counts || accum_steps >= max_steps)
+        {
+            break;
+        }
+        CELER_TRY_HANDLE(counts = step(),
+                         LogContextException{this->output_reg().get()});
+    } while (true);
+    double const time = get_time();
+    EXPECT_LT(accum_steps, max_steps) << "max steps exceeded";
+
+    BenchmarkResult result;
+    result.metrics = {
+        {"num_primaries", num_primaries},
+        {"num_track_slots", num_tracks},
+        {"aosoa", layout == StateLayout::aosoa},
+        {"num_steps", accum_steps},
+        {"num_step_iters", num_iters},
+        {"time", time},
+        {"steps_per_sec", time > 0 ? accum_steps / time : 0},
+        {"peak_memory_mib", peak_memory_mib()},
+    };
+    auto const& aux = step.state().aux();
+    for (auto&& [label, t] : step.actions().get_action_times(aux))
+    {
+        result.action_times.emplace(label, t);
+    }
+    result.step_times = step.actions().get_step_times(aux);
+
+    write_benchmark(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! 100 MeV gammas with fake Compton cross sections in two boxes
+class SimpleComptonBench : public SimpleTestBase, public SteppingBenchBase
+{
+  public:
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{100};
+        p.position = from_cm(Real3{-22, 0, 0});
+        p.direction = {1, 0, 0};
+        p.time = 0;
+        p.event_id = EventId{0};
+        return std::vector<Primary>(count, p);
+    }
+
+    size_type max_average_steps() const override { return 100000; }
+};
+
+//---------------------------------------------------------------------------//
+//! 10 MeV electrons along +x through the TestEm3 calorimeter
+#define TestEm3Bench TEST_IF_CELERITAS_GEANT(TestEm3Bench)
+class TestEm3Bench : public TestEm3Base, public SteppingBenchBase
+{
+  public:
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::electron());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10};
+        p.position = from_cm(Real3{-22, 0, 0});
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = id_cast<EventId>(i);
+        }
+        return result;
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+};
+
+//---------------------------------------------------------------------------//
+//! 1 GeV electrons emitted isotropically from the center of simple CMS
+#define SimpleCmsBench TEST_IF_CELERITAS_GEANT(SimpleCmsBench)
+class SimpleCmsBench : public SimpleCmsTestBase, public SteppingBenchBase
+{
+  public:
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::electron());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{1000};
+        p.position = {0, 0, 0};
+        p.time = 0;
+        p.event_id = EventId{0};
+
+        std::mt19937 rng;
+        IsotropicDistribution<real_type> sample_dir;
+        std::vector<Primary> result(count, p);
+        for (auto& primary : result)
+        {
+            primary.direction = sample_dir(rng);
+        }
+        return result;
+    }
+
+    size_type max_average_steps() const override { return 10000; }
+};
+
+//---------------------------------------------------------------------------//
+//! Simple CMS with tracks reindexed by geometry volume each step
+#define SimpleCmsVolumeBench TEST_IF_CELERITAS_GEANT(SimpleCmsVolumeBench)
+class SimpleCmsVolumeBench : public SimpleCmsBench
+{
+  protected:
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096 * 2;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::reindex_volume;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleComptonBench, host)
+{
+    auto result = this->run_bench(256, 512);
+    EXPECT_GT(result.metrics["num_steps"], 0);
+}
+
+TEST_F(TestEm3Bench, host)
+{
+    auto result = this->run_bench(1024, 64);
+    EXPECT_GT(result.metrics["num_steps"], 0);
+}
+
+TEST_F(TestEm3Bench, host_aosoa)
+{
+    auto result = this->run_bench(1024, 64, StateLayout::aosoa);
+    EXPECT_GT(result.metrics["num_steps"], 0);
+}
+
+TEST_F(SimpleCmsBench, host)
+{
+    auto result = this->run_bench(1024, 16);
+    EXPECT_GT(result.metrics["num_steps"], 0);
+}
+
+TEST_F(SimpleCmsVolumeBench, host)
+{
+    auto result = this->run_bench(1024, 16);
+    EXPECT_GT(result.metrics["num_steps"], 0);
+    EXPECT_EQ(1u, result.action_times.count("sort-tracks-volume"));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -6,15 +6,25 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/ext/detail/HitProcessor.hh"
 
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <G4DynamicParticle.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
 #include <G4ParticleTable.hh>
 #include <G4ThreeVector.hh>
 #include <G4Track.hh>
+#include <G4VSensitiveDetector.hh>
 
+#include "corecel/data/CollectionBuilder.hh"
 #include "geocel/UnitUtils.hh"
 #include "geocel/VolumeParams.hh"
 #include "celeritas/SimpleCmsTestBase.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/ext/GeantSdBatchInterface.hh"
 #include "celeritas/ext/GeantTrackReconstruction.hh"
 #include "celeritas/geo/CoreGeoParams.hh"
 #include "celeritas/phys/PDGNumber.hh"
@@ -35,6 +45,68 @@ namespace detail
 {
 namespace test
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Record the hits passed to a detector that processes them in bulk.
+ */
+class BatchSensitiveDetector final : public G4VSensitiveDetector,
+                                     public GeantSdBatchInterface
+{
+  public:
+    explicit BatchSensitiveDetector(std::string const& name)
+        : G4VSensitiveDetector(name)
+    {
+    }
+
+    void process_hits(DetectorStepOutput const& out,
+                      SpanConstIndex indices) final
+    {
+        thread_ids.push_back(std::this_thread::get_id());
+        batches.emplace_back(indices.begin(), indices.end());
+        for (auto i : indices)
+        {
+            energy_deposition.push_back(out.energy_deposition[i].value());
+        }
+    }
+
+    std::vector<std::vector<size_type>> batches;
+    std::vector<real_type> energy_deposition;
+    std::vector<std::thread::id> thread_ids;
+
+  protected:
+    bool ProcessHits(G4Step*, G4TouchableHistory*) final
+    {
+        ADD_FAILURE() << "batch detector was called for a single hit";
+        return false;
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Append a copy of each hit so that every detector is hit twice
+DetectorStepOutput duplicate_hits(DetectorStepOutput dso)
+{
+    auto append_copy = [](auto& vec) {
+        auto const orig = vec;
+        vec.insert(vec.end(), orig.begin(), orig.end());
+    };
+    append_copy(dso.detector_id);
+    append_copy(dso.track_id);
+    append_copy(dso.primary_id);
+    append_copy(dso.particle_id);
+    append_copy(dso.weight);
+    append_copy(dso.energy_deposition);
+    append_copy(dso.step_length);
+    for (auto sp : range(StepPoint::size_))
+    {
+        auto& points = dso.points[sp];
+        append_copy(points.time);
+        append_copy(points.pos);
+        append_copy(points.dir);
+        append_copy(points.energy);
+        append_copy(points.volume_instance_ids);
+    }
+    return dso;
+}
 
 //---------------------------------------------------------------------------//
 class SimpleCmsTest : public ::celeritas::test::SensDetTestBase,
@@ -46,8 +118,11 @@ class SimpleCmsTest : public ::celeritas::test::SensDetTestBase,
     using SPConstVecLV = HitProcessor::SPConstVecLV;
 
     void SetUp() override;
+    void TearDown() override;
     SetStr detector_volumes() const final;
 
+    BatchSensitiveDetector* use_batch_detector(std::string const& name);
+
     SPConstVecLV make_detector_volumes();
     VecParticle make_particles();
     HitProcessor make_hit_processor();
@@ -74,6 +149,15 @@ class SimpleCmsTest : public ::celeritas::test::SensDetTestBase,
   protected:
     StepSelection selection_;
     HitProcessor::StepPointBool locate_touchable_{{false, false}};
+    bool async_{false};
+
+  private:
+    using UPBatchSD = std::unique_ptr<BatchSensitiveDetector>;
+    using LVAndSD = std::pair<G4LogicalVolume*, G4VSensitiveDetector*>;
+
+    // Temporary batch detectors and the volumes' original detectors
+    std::vector<UPBatchSD> batch_detectors_;
+    std::vector<LVAndSD> orig_detectors_;
 };
 
 int SimpleCmsTest::test_cur_event{0};
@@ -97,6 +181,46 @@ void SimpleCmsTest::SetUp()
     selection_.primary_id = true;
 }
 
+void SimpleCmsTest::TearDown()
+{
+    // Restore the original detectors before deleting the replacements
+    for (auto [lv, sd] : orig_detectors_)
+    {
+        lv->SetSensitiveDetector(sd);
+    }
+    orig_detectors_.clear();
+    batch_detectors_.clear();
+}
+
+/*!
+ * Replace a volume's detector with one that processes hits in bulk.
+ *
+ * The original detector is restored at the end of the test.
+ */
+auto SimpleCmsTest::use_batch_detector(std::string const& name)
+    -> BatchSensitiveDetector*
+{
+    // Make sure geometry is built
+    this->geometry();
+
+    auto iter = this->detectors().find(name);
+    CELER_ASSERT(iter != this->detectors().end());
+    G4LogicalVolume const* detector_lv = iter->second->lv();
+
+    for (G4LogicalVolume* lv : *G4LogicalVolumeStore::GetInstance())
+    {
+        if (lv == detector_lv)
+        {
+            orig_detectors_.emplace_back(lv, lv->GetSensitiveDetector());
+            batch_detectors_.push_back(
+                std::make_unique<BatchSensitiveDetector>(name));
+            lv->SetSensitiveDetector(batch_detectors_.back().get());
+            return batch_detectors_.back().get();
+        }
+    }
+    CELER_ASSERT_UNREACHABLE();
+}
+
 auto SimpleCmsTest::detector_volumes() const -> SetStr
 {
     return {
@@ -151,7 +275,8 @@ auto SimpleCmsTest::make_hit_processor() -> HitProcessor
     return HitProcessor{this->make_detector_volumes(),
                         this->make_particles(),
                         selection_,
-                        locate_touchable_};
+                        locate_touchable_,
+                        async_};
 }
 
 auto SimpleCmsTest::get_hits(std::string const& name) const
@@ -642,6 +767,237 @@ TEST_F(SimpleCmsTest, with_primary_id)
     }
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, batch_grouping)
+{
+    selection_.particle_id = false;
+    selection_.primary_id = false;
+    std::vector<BatchSensitiveDetector*> sd;
+    for (auto const& name : this->detector_volumes())
+    {
+        sd.push_back(this->use_batch_detector(name));
+    }
+    HitProcessor process_hits = this->make_hit_processor();
+
+    // Detector IDs are ordered by name: em, had, si, world
+    DetectorStepOutput dso;
+    dso.detector_id = {
+        DetectorId{2},
+        DetectorId{0},
+        DetectorId{2},
+        DetectorId{1},
+        DetectorId{0},
+        DetectorId{2},
+    };
+    dso.track_id.assign(dso.detector_id.size(), TrackId{0});
+    dso.energy_deposition = {
+        MevEnergy{1},
+        MevEnergy{2},
+        MevEnergy{3},
+        MevEnergy{4},
+        MevEnergy{5},
+        MevEnergy{6},
+    };
+    process_hits(dso);
+
+    // Each detector is called once with its hits in their original order
+    {
+        auto const& result = *sd[0];
+        ASSERT_EQ(1, result.batches.size());
+        static size_type const expected_indices[] = {1u, 4u};
+        EXPECT_VEC_EQ(expected_indices, result.batches.front());
+        static real_type const expected_energy_deposition[] = {2, 5};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+    {
+        auto const& result = *sd[1];
+        ASSERT_EQ(1, result.batches.size());
+        static size_type const expected_indices[] = {3u};
+        EXPECT_VEC_EQ(expected_indices, result.batches.front());
+    }
+    {
+        auto const& result = *sd[2];
+        ASSERT_EQ(1, result.batches.size());
+        static size_type const expected_indices[] = {0u, 2u, 5u};
+        EXPECT_VEC_EQ(expected_indices, result.batches.front());
+        static real_type const expected_energy_deposition[] = {1, 3, 6};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+    // Detectors without hits are not called
+    EXPECT_EQ(0, sd[3]->batches.size());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, batch_dispatch)
+{
+    selection_.particle_id = false;
+    selection_.primary_id = false;
+    auto* em_sd = this->use_batch_detector("em_calorimeter");
+    HitProcessor process_hits = this->make_hit_processor();
+
+    // Hits: si, em, had, si, em, had
+    auto dso = duplicate_hits(this->make_dso());
+    process_hits(dso);
+
+    // Batch detector receives all of its hits at once
+    ASSERT_EQ(1, em_sd->batches.size());
+    static size_type const expected_indices[] = {1u, 4u};
+    EXPECT_VEC_EQ(expected_indices, em_sd->batches.front());
+    EXPECT_EQ(0, this->get_hits("em_calorimeter").energy_deposition.size());
+
+    // Other detectors are called for each hit
+    {
+        auto& result = this->get_hits("si_tracker");
+        static real_type const expected_energy_deposition[]
+            = {1.0 * 0.1, 1.0 * 0.1};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+    {
+        auto& result = this->get_hits("had_calorimeter");
+        static real_type const expected_energy_deposition[]
+            = {0.8 * 0.3, 0.8 * 0.3};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, touchable_reuse)
+{
+    selection_.particle_id = false;
+    selection_.primary_id = false;
+    locate_touchable_ = {true, false};
+    HitProcessor process_hits = this->make_hit_processor();
+
+    // Hits: si, em, had, si, em, had
+    auto dso = duplicate_hits(this->make_dso());
+    process_hits(dso);
+
+    // The second hit in each detector is in the same volume instance
+    EXPECT_EQ(3, process_hits.num_relocations());
+
+    // Touchables are relocated at the start of each batch
+    process_hits(dso);
+    EXPECT_EQ(6, process_hits.num_relocations());
+
+    // Change the volume instance of the second si_tracker hit
+    auto const& vi_names = this->volumes()->volume_instance_labels();
+    auto& vi_ids = dso.points[StepPoint::pre].volume_instance_ids;
+    ASSERT_EQ(12, vi_ids.size());
+    vi_ids[3 * dso.num_volume_levels + 1]
+        = vi_names.find_unique("em_calorimeter_pv");
+    process_hits(dso);
+    EXPECT_EQ(10, process_hits.num_relocations());
+
+    {
+        auto& result = this->get_hits("si_tracker");
+        static char const* const expected_pre_physvol[] = {
+            "si_tracker_pv",
+            "si_tracker_pv",
+            "si_tracker_pv",
+            "si_tracker_pv",
+            "si_tracker_pv",
+            "em_calorimeter_pv",
+        };
+        EXPECT_VEC_EQ(expected_pre_physvol, result.pre_physvol);
+    }
+    {
+        auto& result = this->get_hits("had_calorimeter");
+        static char const* const expected_pre_physvol[] = {
+            "had_calorimeter_pv",
+            "had_calorimeter_pv",
+            "had_calorimeter_pv",
+            "had_calorimeter_pv",
+            "had_calorimeter_pv",
+            "had_calorimeter_pv",
+        };
+        EXPECT_VEC_EQ(expected_pre_physvol, result.pre_physvol);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, async_requires_batch)
+{
+    selection_.particle_id = false;
+    selection_.primary_id = false;
+    async_ = true;
+
+    // Other detectors would be called from the helper thread
+    this->use_batch_detector("em_calorimeter");
+    EXPECT_THROW(this->make_hit_processor(), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, async)
+{
+    selection_.particle_id = false;
+    selection_.primary_id = false;
+    async_ = true;
+    std::vector<BatchSensitiveDetector*> sd;
+    for (auto const& name : this->detector_volumes())
+    {
+        sd.push_back(this->use_batch_detector(name));
+    }
+    HitProcessor process_hits = this->make_hit_processor();
+
+    // Create host step states with one track outside the detectors
+    HostVal<StepStateData> host_states;
+    host_states.stream_id = StreamId{0};
+    make_builder(&host_states.data.track_id)
+        .insert_back({TrackId{0}, TrackId{1}, TrackId{2}, TrackId{3}});
+    make_builder(&host_states.data.detector_id)
+        .insert_back(
+            {DetectorId{2}, DetectorId{}, DetectorId{0}, DetectorId{2}});
+    make_builder(&host_states.data.energy_deposition)
+        .insert_back({MevEnergy{1}, MevEnergy{2}, MevEnergy{3}, MevEnergy{4}});
+    HostRef<StepStateData> states;
+    states = host_states;
+
+    // Submit several steps before waiting for the detectors
+    for (int i = 0; i < 3; ++i)
+    {
+        process_hits(states);
+    }
+    process_hits.wait();
+    EXPECT_EQ(9, process_hits.exchange_hits());
+
+    {
+        // em_calorimeter
+        auto const& result = *sd[0];
+        ASSERT_EQ(3, result.batches.size());
+        static size_type const expected_indices[] = {1u};
+        EXPECT_VEC_EQ(expected_indices, result.batches.back());
+        static real_type const expected_energy_deposition[] = {3, 3, 3};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+    {
+        // si_tracker
+        auto const& result = *sd[2];
+        ASSERT_EQ(3, result.batches.size());
+        static size_type const expected_indices[] = {0u, 2u};
+        EXPECT_VEC_EQ(expected_indices, result.batches.back());
+        static real_type const expected_energy_deposition[]
+            = {1, 4, 1, 4, 1, 4};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+    EXPECT_EQ(0, sd[1]->batches.size());
+    EXPECT_EQ(0, sd[3]->batches.size());
+
+    // Detectors were called from the helper thread
+    for (auto* d : sd)
+    {
+        for (auto const& id : d->thread_ids)
+        {
+            EXPECT_NE(std::this_thread::get_id(), id);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail
@@ -0,0 +1,116 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/detail/HitWorker.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/ext/detail/HitWorker.hh"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Fill a buffer with hits in the given detectors
+void fill(DetectorStepOutput* out, std::vector<DetectorId> const& detectors)
+{
+    out->detector_id.assign(detectors.begin(), detectors.end());
+    out->track_id.assign(detectors.size(), TrackId{0});
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(HitWorkerTest, double_buffer)
+{
+    std::vector<std::thread::id> threads;
+    std::vector<DetectorStepOutput const*> buffers;
+    std::vector<size_type> sizes;
+
+    HitWorker worker([&](DetectorStepOutput const& out) {
+        threads.push_back(std::this_thread::get_id());
+        buffers.push_back(&out);
+        sizes.push_back(out.size());
+    });
+
+    // Buffers alternate between submissions
+    DetectorStepOutput* first = &worker.front();
+    fill(first, {DetectorId{0}});
+    worker.submit();
+    DetectorStepOutput* second = &worker.front();
+    EXPECT_NE(first, second);
+    fill(second, {DetectorId{1}, DetectorId{0}});
+    worker.submit();
+    EXPECT_EQ(first, &worker.front());
+    fill(first, {DetectorId{2}, DetectorId{2}, DetectorId{1}});
+    worker.submit();
+    worker.wait();
+
+    // Batches are processed in order on the helper thread
+    static size_type const expected_sizes[] = {1u, 2u, 3u};
+    EXPECT_VEC_EQ(expected_sizes, sizes);
+    ASSERT_EQ(3, buffers.size());
+    EXPECT_EQ(first, buffers[0]);
+    EXPECT_EQ(second, buffers[1]);
+    EXPECT_EQ(first, buffers[2]);
+    for (auto const& id : threads)
+    {
+        EXPECT_NE(std::this_thread::get_id(), id);
+    }
+
+    // Waiting again is a null-op
+    worker.wait();
+    EXPECT_EQ(3, sizes.size());
+}
+
+TEST(HitWorkerTest, error)
+{
+    int num_processed{0};
+    HitWorker worker([&](DetectorStepOutput const& out) {
+        ++num_processed;
+        if (out.size() == 2)
+        {
+            throw std::runtime_error("failed to process hits");
+        }
+    });
+
+    fill(&worker.front(), {DetectorId{0}, DetectorId{1}});
+    worker.submit();
+
+    // Error is rethrown on the transport thread once
+    EXPECT_THROW(worker.wait(), std::runtime_error);
+    worker.wait();
+
+    // Worker continues to process later batches
+    fill(&worker.front(), {DetectorId{0}});
+    worker.submit();
+    fill(&worker.front(), {DetectorId{1}, DetectorId{0}});
+    worker.submit();
+    EXPECT_THROW(worker.submit(), std::runtime_error);
+    EXPECT_EQ(3, num_processed);
+}
+
+TEST(HitWorkerTest, destroy_pending)
+{
+    int num_processed{0};
+    {
+        HitWorker worker(
+            [&](DetectorStepOutput const&) { ++num_processed; });
+        fill(&worker.front(), {DetectorId{0}});
+        worker.submit();
+    }
+    // The submitted batch is finished before the worker stops
+    EXPECT_EQ(1, num_processed);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -23,6 +23,7 @@
 #include "celeritas/Quantities.hh"
 #include "celeritas/field/DormandPrinceIntegrator.hh"
 #include "celeritas/field/FieldDriverOptions.hh"
+#include "celeritas/field/HelixMixedIntegrator.hh"
 #include "celeritas/field/MakeMagFieldPropagator.hh"
 #include "celeritas/field/UniformZField.hh"
 #include "celeritas/geo/CoreGeoParams.hh"
@@ -269,6 +270,25 @@ TEST_F(TwoBoxesTest, positron_interior)
     EXPECT_SOFT_EQ(1.0, dot_product(Real3({-1, 0, 0}), geo.dir()));
 }
 
+TEST_F(TwoBoxesTest, positron_interior_helix)
+{
+    // Same as above but with an analytic helix
+    real_type const radius{1.0};
+    auto particle = this->make_particle_view(pdg::positron(), MevEnergy{10});
+    auto geo = this->make_geo_track_view({radius, 0, 0}, {0, -1, 0});
+    UniformZField field(unit_radius_field_strength);
+
+    FieldDriverOptions driver_options;
+    auto propagate = make_mag_field_propagator<HelixMixedIntegrator>(
+        field, driver_options, particle, geo);
+
+    // Test a quarter turn
+    Propagation result = propagate(0.5 * pi * radius);
+    EXPECT_SOFT_EQ(0.5 * pi * radius, result.distance);
+    EXPECT_NEAR(0, distance(Real3({0, -radius, 0}), geo.pos()), 1e-8);
+    EXPECT_SOFT_EQ(1.0, dot_product(Real3({-1, 0, 0}), geo.dir()));
+}
+
 // Gamma in magnetic field should have a linear path
 TEST_F(TwoBoxesTest, gamma_interior)
 {
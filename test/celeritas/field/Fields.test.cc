@@ -18,6 +18,7 @@
 #include "corecel/data/HyperslabIndexer.hh"
 #include "corecel/grid/GridTypes.hh"
 #include "corecel/grid/Interpolator.hh"
+#include "corecel/io/Repr.hh"
 #include "corecel/math/Quantity.hh"
 #include "corecel/math/Turn.hh"
 #include "geocel/Types.hh"
@@ -253,11 +254,11 @@ TEST_F(RZMapFieldTest, TEST_IF_CELER_DEVICE(device))
     EXPECT_VEC_NEAR(expected_field, actual, real_type{2e-7});
 }
 
-using CylMapFieldTest = ::celeritas::test::Test;
-
-TEST_F(CylMapFieldTest, all)
+class CylMapFieldTest : public ::celeritas::test::Test
 {
-    CylMapFieldParams field_map = [] {
+  protected:
+    static CylMapFieldParams make_field_map()
+    {
         inp::CylMapField inp;
         // Set up grid points in cylindrical coordinates
         inp.grid_r = {0, 50, 100, 150};
@@ -306,8 +307,12 @@ TEST_F(CylMapFieldTest, all)
             }
         }
         return CylMapFieldParams(inp);
-    }();
+    }
+};
 
+TEST_F(CylMapFieldTest, all)
+{
+    CylMapFieldParams field_map = this->make_field_map();
     CylMapField calc_field(field_map.host_ref());
 
     // Define samples in cylindrical coordinates
@@ -366,6 +371,29 @@ TEST_F(CylMapFieldTest, all)
     EXPECT_VEC_NEAR(expected_field, actual, 1e-7_r);
 }
 
+TEST_F(CylMapFieldTest, cached_cell)
+{
+    CylMapFieldParams field_map = this->make_field_map();
+    CylMapField calc_field(field_map.host_ref());
+
+    // Step through several cells, revisiting some, with multiple points per
+    // cell and points outside the map
+    for (Real3 pos : {Real3{10, 1, -20},
+                      Real3{11, 2, -21},
+                      Real3{12, 2.5, -40},
+                      Real3{60, 1, -40},
+                      Real3{-20, 30, 80},
+                      Real3{200, 0, 0},
+                      Real3{12, 3, -45},
+                      Real3{0, 0, 0},
+                      Real3{1, 0, 149}})
+    {
+        // Compare against a new field with an empty cache
+        Real3 expected = CylMapField(field_map.host_ref())(pos);
+        EXPECT_VEC_EQ(expected, calc_field(pos)) << "at " << repr(pos);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // COVFIE IMPORT TESTS
 //---------------------------------------------------------------------------//
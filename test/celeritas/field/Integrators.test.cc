@@ -15,6 +15,7 @@
 #include "celeritas/Quantities.hh"
 #include "celeritas/Units.hh"
 #include "celeritas/field/DormandPrinceIntegrator.hh"
+#include "celeritas/field/HelixMixedIntegrator.hh"
 #include "celeritas/field/MagFieldEquation.hh"
 #include "celeritas/field/MakeMagFieldPropagator.hh"
 #include "celeritas/field/RungeKuttaIntegrator.hh"
@@ -22,6 +23,7 @@
 #include "celeritas/field/UniformZField.hh"
 #include "celeritas/field/ZHelixIntegrator.hh"
 
+#include "CMSParameterizedField.hh"
 #include "FieldTestParams.hh"
 #include "celeritas_test.hh"
 
@@ -168,6 +170,86 @@ TEST_F(IntegratorsTest, host_dormand_prince_547)
 
     // Test the Dormand-Prince 547(M) integrate
     this->run_integration<UniformField, DormandPrinceIntegrator>(field);
-}  //---------------------------------------------------------------------------//
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IntegratorsTest, host_helix_mixed)
+{
+    // Construct a uniform magnetic field
+    UniformField field(Real3{0, 0, param.field_value});
+
+    // Test the mixed helix integrate
+    this->run_integration<UniformField, HelixMixedIntegrator>(field);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IntegratorsTest, host_helix_mixed_oblique)
+{
+    // Uniform field along an arbitrary direction
+    UniformField field(Real3{0.3, -0.4, 1.2} * param.field_value);
+
+    OdeState y;
+    y.pos = {1, 2, 3};
+    y.mom = {2, param.momentum_y, param.momentum_z};
+
+    for (int charge : {-1, 1})
+    {
+        auto integrate_helix = make_mag_field_integrator<HelixMixedIntegrator>(
+            field, units::ElementaryCharge{static_cast<real_type>(charge)});
+        auto integrate_rk = make_mag_field_integrator<DormandPrinceIntegrator>(
+            field, units::ElementaryCharge{static_cast<real_type>(charge)});
+
+        for (real_type step : {1e-4, 0.1, 1.0, 10.0})
+        {
+            // Compare against many small Runge-Kutta steps
+            OdeState expected = y;
+            constexpr int num_substeps = 200;
+            for ([[maybe_unused]] int i : range(num_substeps))
+            {
+                expected
+                    = integrate_rk(step / num_substeps, expected).end_state;
+            }
+
+            FieldIntegration result = integrate_helix(step, y);
+            real_type tol = 1e-7 * max(step, real_type{1});
+            EXPECT_VEC_NEAR(expected.pos, result.end_state.pos, tol)
+                << "q=" << charge << ", step=" << step;
+            EXPECT_VEC_NEAR(expected.mom, result.end_state.mom, tol)
+                << "q=" << charge << ", step=" << step;
+            EXPECT_SOFT_EQ(norm(y.mom), norm(result.end_state.mom));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IntegratorsTest, host_helix_mixed_fallback)
+{
+    // Strongly nonuniform field near the end of the CMS solenoid
+    CMSParameterizedField field;
+
+    auto integrate_helix = make_mag_field_integrator<HelixMixedIntegrator>(
+        field, units::ElementaryCharge{-1});
+    auto integrate_rk = make_mag_field_integrator<DormandPrinceIntegrator>(
+        field, units::ElementaryCharge{-1});
+
+    OdeState y;
+    y.pos = {100, 50, 250};
+    y.mom = {0, param.momentum_y, param.momentum_z};
+
+    // Long step through a field gradient uses Runge-Kutta
+    FieldIntegration expected = integrate_rk(10.0, y);
+    FieldIntegration actual = integrate_helix(10.0, y);
+    EXPECT_VEC_EQ(expected.end_state.pos, actual.end_state.pos);
+    EXPECT_VEC_EQ(expected.end_state.mom, actual.end_state.mom);
+    EXPECT_VEC_EQ(expected.err_state.pos, actual.err_state.pos);
+
+    // Very short step sees a nearly uniform field
+    expected = integrate_rk(1e-6, y);
+    actual = integrate_helix(1e-6, y);
+    EXPECT_VEC_NEAR(expected.end_state.pos, actual.end_state.pos, 1e-12);
+    EXPECT_VEC_NEAR(expected.end_state.mom, actual.end_state.mom, 1e-10);
+}
+
+//---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -72,7 +72,7 @@ TEST(JsonIO, diagnostics)
     input.step.emplace();
 
     static char const expected[]
-        = R"json({"action":false,"counters":{"event":true,"step":true},"export_files":{"geometry":"geometry.gdml","offload":"offload.jsonl","physics":"physics.root"},"log_frequency":1,"mctruth":{"filter":{"event_id":null,"parent_id":null,"post_step_action_id":null,"track_id":[]},"output_file":"mctruth.root"},"output_file":"-","perfetto_file":"","slot":{"basename":"slot"},"status_checker":false,"step":{"bins":1000},"timers":{"action":false,"step":false}})json";
+        = R"json({"action":false,"counters":{"event":true,"step":true,"xs_cache":false},"export_files":{"geometry":"geometry.gdml","offload":"offload.jsonl","physics":"physics.root"},"log_frequency":1,"mctruth":{"filter":{"event_id":null,"parent_id":null,"post_step_action_id":null,"track_id":[]},"output_file":"mctruth.root"},"output_file":"-","perfetto_file":"","slot":{"basename":"slot"},"status_checker":false,"step":{"bins":1000},"timers":{"action":false,"step":false}})json";
     EXPECT_JSON_ROUND_TRIP(input, expected);
 }
 
@@ -139,7 +139,7 @@ TEST(JsonIO, events)
         }();
 
         static char const expected[]
-            = R"json({"generator":{"_type":"sample","event_file":"events.root","num_events":8,"num_merged":2,"seed":12345},"merge":false})json";
+            = R"json({"generator":{"_type":"sample","event_file":"events.root","num_events":8,"num_merged":2,"seed":12345},"largest_first":false,"merge":false,"prefetch":0})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
     {
@@ -152,7 +152,7 @@ TEST(JsonIO, events)
         }();
 
         static char const expected[]
-            = R"json({"generator":{"_type":"read","event_file":"events.root"},"merge":true})json";
+            = R"json({"generator":{"_type":"read","event_file":"events.root"},"largest_first":false,"merge":true,"prefetch":0})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
     {
@@ -170,7 +170,7 @@ TEST(JsonIO, events)
         }();
 
         static char const expected[]
-            = R"json({"generator":{"_type":"primary","angle":{"_type":"delta","value":[0.0,0.0,1.0]},"energy":{"_type":"normal","mean":1.0,"stddev":0.0},"num_events":4,"pdg":[11],"primaries_per_event":1023,"seed":12345,"shape":{"_type":"uniform_box","lower":[0.0,0.0,0.0],"upper":[1.0,1.0,1.0]}},"merge":false})json";
+            = R"json({"generator":{"_type":"primary","angle":{"_type":"delta","value":[0.0,0.0,1.0]},"energy":{"_type":"normal","mean":1.0,"stddev":0.0},"num_events":4,"pdg":[11],"primaries_per_event":1023,"seed":12345,"shape":{"_type":"uniform_box","lower":[0.0,0.0,0.0],"upper":[1.0,1.0,1.0]}},"largest_first":false,"merge":false,"prefetch":0})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
 }
@@ -193,7 +193,7 @@ TEST(JsonIO, field)
         if (CELERITAS_UNITS == CELERITAS_UNITS_CGS)
         {
             static char const expected[]
-                = R"json({"_type":"uniform","driver_options":{"_format":"field-driver","_units":"cgs","_version":"0.7.0","delta_chord":0.025,"delta_intersection":1e-05,"epsilon_rel_max":0.001,"epsilon_step":1e-05,"errcon":0.0001,"max_nsteps":100,"max_stepping_decrease":0.1,"max_stepping_increase":5.0,"max_substeps":10,"minimum_step":1.0000000000000002e-06,"pgrow":-0.2,"pshrink":-0.25,"safety":0.9},"strength":[0.0,0.0,1.0],"units":2})json";
+                = R"json({"_type":"uniform","driver_options":{"_format":"field-driver","_units":"cgs","_version":"0.7.0","delta_chord":0.025,"delta_intersection":1e-05,"epsilon_rel_max":0.001,"epsilon_step":1e-05,"errcon":0.0001,"helix_field_tol":0.0,"max_nsteps":100,"max_stepping_decrease":0.1,"max_stepping_increase":5.0,"max_substeps":10,"minimum_step":1.0000000000000002e-06,"pgrow":-0.2,"pshrink":-0.25,"safety":0.9},"strength":[0.0,0.0,1.0],"units":2})json";
             EXPECT_JSON_ROUND_TRIP(input, expected);
         }
     }
@@ -210,7 +210,7 @@ TEST(JsonIO, field)
         if (CELERITAS_UNITS == CELERITAS_UNITS_CGS)
         {
             static char const expected[]
-                = R"json({"_type":"cylmap","driver_options":{"_format":"field-driver","_units":"cgs","_version":"0.7.0","delta_chord":0.025,"delta_intersection":1e-05,"epsilon_rel_max":0.001,"epsilon_step":1e-05,"errcon":0.0001,"max_nsteps":100,"max_stepping_decrease":0.1,"max_stepping_increase":5.0,"max_substeps":10,"minimum_step":1.0000000000000002e-06,"pgrow":-0.2,"pshrink":-0.25,"safety":0.9},"field":[0.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0],"grid_phi":[[0.0,"tr"],[1.0,"tr"]],"grid_r":[0.0,1.0],"grid_z":[-100.0,100.0]})json";
+                = R"json({"_type":"cylmap","driver_options":{"_format":"field-driver","_units":"cgs","_version":"0.7.0","delta_chord":0.025,"delta_intersection":1e-05,"epsilon_rel_max":0.001,"epsilon_step":1e-05,"errcon":0.0001,"helix_field_tol":0.0,"max_nsteps":100,"max_stepping_decrease":0.1,"max_stepping_increase":5.0,"max_substeps":10,"minimum_step":1.0000000000000002e-06,"pgrow":-0.2,"pshrink":-0.25,"safety":0.9},"field":[0.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0],"grid_phi":[[0.0,"tr"],[1.0,"tr"]],"grid_r":[0.0,1.0],"grid_z":[-100.0,100.0]})json";
             EXPECT_JSON_ROUND_TRIP(input, expected);
         }
     }
@@ -232,7 +232,7 @@ TEST(JsonIO, field)
         if (CELERITAS_UNITS == CELERITAS_UNITS_CGS)
         {
             static char const expected[]
-                = R"json({"_type":"cartmap","driver_options":{"_format":"field-driver","_units":"cgs","_version":"0.7.0","delta_chord":0.025,"delta_intersection":1e-05,"epsilon_rel_max":0.001,"epsilon_step":1e-05,"errcon":0.0001,"max_nsteps":100,"max_stepping_decrease":0.1,"max_stepping_increase":5.0,"max_substeps":10,"minimum_step":1.0000000000000002e-06,"pgrow":-0.2,"pshrink":-0.25,"safety":0.9},"field":[0.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0],"x":{"max":10.0,"min":-10.0,"num":2},"y":{"max":10.0,"min":-10.0,"num":2},"z":{"max":10.0,"min":-10.0,"num":2}})json";
+                = R"json({"_type":"cartmap","driver_options":{"_format":"field-driver","_units":"cgs","_version":"0.7.0","delta_chord":0.025,"delta_intersection":1e-05,"epsilon_rel_max":0.001,"epsilon_step":1e-05,"errcon":0.0001,"helix_field_tol":0.0,"max_nsteps":100,"max_stepping_decrease":0.1,"max_stepping_increase":5.0,"max_substeps":10,"minimum_step":1.0000000000000002e-06,"pgrow":-0.2,"pshrink":-0.25,"safety":0.9},"field":[0.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0],"x":{"max":10.0,"min":-10.0,"num":2},"y":{"max":10.0,"min":-10.0,"num":2},"z":{"max":10.0,"min":-10.0,"num":2}})json";
             EXPECT_JSON_ROUND_TRIP(input, expected);
         }
     }
@@ -259,7 +259,7 @@ TEST(JsonIO, physics_import)
         }();
 
         static char const expected[]
-            = R"json({"_type":"geant","data_selection":{"interpolation":{"bc":"geant","order":1,"type":"linear"}},"ignore_processes":["CoulombScat"]})json";
+            = R"json({"_type":"geant","cache_file":"","data_selection":{"interpolation":{"bc":"geant","order":1,"type":"linear"}},"ignore_processes":["CoulombScat"]})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
 }
@@ -365,7 +365,7 @@ TEST(JsonIO, optical_standalone_input)
     input.problem.limits.step_iters = 10000;
 
     static char const expected[]
-        = R"json({"_format":"optical-standalone-input","_version":"0.7.0","geant_setup":{"_format":"geant4-optical-physics","_version":"0.7.0","absorption":true,"boundary":{"invoke_sd":false},"cherenkov":{"max_beta_change":10.0,"max_photons":100,"stack_photons":true,"track_secondaries_first":true},"mie_scattering":true,"rayleigh_scattering":true,"scintillation":{"by_particle_type":false,"finite_rise_time":false,"stack_photons":true,"track_info":false,"track_secondaries_first":true},"verbose":false,"wavelength_shifting":{"time_profile":"delta"},"wavelength_shifting2":{"time_profile":"delta"}},"problem":{"capacity":{"generators":null,"primaries":null,"tracks":null},"generator":{"_type":"em"},"limits":{"step_iters":10000,"steps":1000},"model":{"geometry":"geometry.gdml"},"output_file":"-","perfetto_file":null,"seed":0,"step":null,"timers":{"action":false,"step":false}},"system":{"device":null,"environment":{}}})json";
+        = R"json({"_format":"optical-standalone-input","_version":"0.7.0","geant_setup":{"_format":"geant4-optical-physics","_version":"0.7.0","absorption":true,"boundary":{"invoke_sd":false},"cherenkov":{"max_beta_change":10.0,"max_photons":100,"stack_photons":true,"track_secondaries_first":true},"mie_scattering":true,"rayleigh_scattering":true,"scintillation":{"by_particle_type":false,"finite_rise_time":false,"stack_photons":true,"track_info":false,"track_secondaries_first":true},"verbose":false,"wavelength_shifting":{"time_profile":"delta"},"wavelength_shifting2":{"time_profile":"delta"}},"problem":{"biasing":{"photon_scale":1.0,"roulette_steps":0,"roulette_survival":0.5},"capacity":{"generators":null,"primaries":null,"tracks":null},"generator":{"_type":"em"},"limits":{"interleave_step_iters":0,"step_iters":10000,"steps":1000},"model":{"geometry":"geometry.gdml"},"output_file":"-","perfetto_file":null,"seed":0,"step":null,"timers":{"action":false,"step":false}},"system":{"device":null,"environment":{},"share_params":false}})json";
     EXPECT_JSON_ROUND_TRIP(input, expected);
 }
 
@@ -382,7 +382,7 @@ TEST(JsonIO, standalone_input)
     if (CELERITAS_UNITS == CELERITAS_UNITS_CGS)
     {
         static char const expected[]
-            = R"json({"_format":"standalone-input","_version":"0.7.0","events":{"generator":{"_type":"read","event_file":"events.json"},"merge":false},"geant_setup":{"_format":"geant-physics","_units":"cgs","_version":"0.7.0","angle_limit_factor":1.0,"annihilation":true,"apply_cuts":false,"brems":"all","compton_scattering":true,"coulomb_scattering":false,"default_cutoff":0.1,"eloss_fluctuation":true,"em_bins_per_decade":7,"form_factor":"exponential","gamma_conversion":true,"gamma_general":false,"integral_approach":true,"ionization":true,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"lowest_muhad_energy":[0.001,"MeV"],"lpm":true,"max_energy":[100000000.0,"MeV"],"min_energy":[0.0001,"MeV"],"msc":"urban","msc_displaced":true,"msc_lambda_limit":0.1,"msc_muhad_displaced":false,"msc_muhad_range_factor":0.2,"msc_muhad_step_algorithm":"minimal","msc_range_factor":0.04,"msc_safety_factor":0.6,"msc_step_algorithm":"safety","msc_theta_limit":3.141592653589793,"mucf_physics":false,"muon":null,"optical":null,"photoelectric":true,"rayleigh_scattering":true,"relaxation":"none","seltzer_berger_limit":[1000.0,"MeV"],"verbose":false},"physics_import":{"_type":"geant","data_selection":{"interpolation":{"bc":"geant","order":1,"type":"linear"}},"ignore_processes":[]},"problem":{"control":{"capacity":{"events":null,"initializers":null,"primaries":null,"secondaries":null,"tracks":null},"device_debug":null,"optical_capacity":null,"seed":0,"track_order":null,"warm_up":false},"diagnostics":{"action":false,"counters":{"event":true,"step":true},"export_files":{"geometry":"","offload":"","physics":""},"log_frequency":1,"mctruth":null,"output_file":"-","perfetto_file":"","slot":null,"status_checker":false,"step":null,"timers":{"action":false,"step":false}},"field":{"_type":"none"},"model":{"geometry":"geometry.gdml"},"scoring":{"simple_calo":null},"tracking":{"force_step_limit":0.0,"limits":{"field_substeps":10,"step_iters":1000,"steps":100},"optical_limits":{"step_iters":0,"steps":0}}},"system":{"device":null,"environment":{}}})json";
+            = R"json({"_format":"standalone-input","_version":"0.7.0","events":{"generator":{"_type":"read","event_file":"events.json"},"largest_first":false,"merge":false,"prefetch":0},"geant_setup":{"_format":"geant-physics","_units":"cgs","_version":"0.7.0","angle_limit_factor":1.0,"annihilation":true,"apply_cuts":false,"brems":"all","compton_scattering":true,"coulomb_scattering":false,"default_cutoff":0.1,"eloss_fluctuation":true,"em_bins_per_decade":7,"form_factor":"exponential","gamma_conversion":true,"gamma_general":false,"integral_approach":true,"ionization":true,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"lowest_muhad_energy":[0.001,"MeV"],"lpm":true,"max_energy":[100000000.0,"MeV"],"min_energy":[0.0001,"MeV"],"msc":"urban","msc_displaced":true,"msc_lambda_limit":0.1,"msc_muhad_displaced":false,"msc_muhad_range_factor":0.2,"msc_muhad_step_algorithm":"minimal","msc_range_factor":0.04,"msc_safety_factor":0.6,"msc_step_algorithm":"safety","msc_theta_limit":3.141592653589793,"mucf_physics":false,"muon":null,"optical":null,"photoelectric":true,"rayleigh_scattering":true,"relaxation":"none","seltzer_berger_limit":[1000.0,"MeV"],"verbose":false},"physics_import":{"_type":"geant","cache_file":"","data_selection":{"interpolation":{"bc":"geant","order":1,"type":"linear"}},"ignore_processes":[]},"problem":{"control":{"capacity":{"events":null,"initializers":null,"primaries":null,"secondaries":null,"tracks":null},"device_debug":null,"optical_capacity":null,"seed":0,"track_order":null,"warm_up":false},"diagnostics":{"action":false,"counters":{"event":true,"step":true,"xs_cache":false},"export_files":{"geometry":"","offload":"","physics":""},"log_frequency":1,"mctruth":null,"output_file":"-","perfetto_file":"","slot":null,"status_checker":false,"step":null,"timers":{"action":false,"step":false}},"field":{"_type":"none"},"model":{"geometry":"geometry.gdml"},"scoring":{"simple_calo":null},"tracking":{"force_step_limit":0.0,"limits":{"field_substeps":10,"step_iters":1000,"steps":100},"optical_biasing":{"photon_scale":1.0,"roulette_steps":0,"roulette_survival":0.5},"optical_limits":{"interleave_step_iters":0,"step_iters":0,"steps":0}}},"system":{"device":null,"environment":{},"share_params":false}})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
 }
@@ -394,7 +394,7 @@ TEST(JsonIO, system)
     {
         // Without optional device
         static char const expected[]
-            = R"json({"device":null,"environment":{"ONE":"1","TWO":"2"}})json";
+            = R"json({"device":null,"environment":{"ONE":"1","TWO":"2"},"share_params":false})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
 
@@ -404,7 +404,7 @@ TEST(JsonIO, system)
     {
         // With device
         static char const expected[]
-            = R"json({"device":{"heap_size":8192,"stack_size":1024},"environment":{"ONE":"1","TWO":"2"}})json";
+            = R"json({"device":{"heap_size":8192,"stack_size":1024},"environment":{"ONE":"1","TWO":"2"},"share_params":false})json";
         EXPECT_JSON_ROUND_TRIP(input, expected);
     }
 }
@@ -419,7 +419,7 @@ TEST(JsonIO, tracking)
     input.optical_limits.step_iters = 0;
 
     static char const expected[]
-        = R"json({"force_step_limit":0.0,"limits":{"field_substeps":100,"step_iters":10000,"steps":1000},"optical_limits":{"step_iters":0,"steps":0}})json";
+        = R"json({"force_step_limit":0.0,"limits":{"field_substeps":100,"step_iters":10000,"steps":1000},"optical_biasing":{"photon_scale":1.0,"roulette_steps":0,"roulette_survival":0.5},"optical_limits":{"interleave_step_iters":0,"step_iters":0,"steps":0}})json";
     EXPECT_JSON_ROUND_TRIP(input, expected);
 }
 
@@ -0,0 +1,136 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportDataCache.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/ImportDataCache.hh"
+
+#include "celeritas/inp/MucfPhysics.hh"
+#include "celeritas/io/ImportData.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class ImportDataCacheTest : public ::celeritas::test::Test
+{
+  protected:
+    static ImportData make_data()
+    {
+        ImportData result;
+        result.units = "cgs";
+
+        ImportElement el;
+        el.name = "H";
+        el.atomic_number = 1;
+        el.atomic_mass = 1.008;
+        el.isotopes_fractions = {{0, 1.0}};
+        result.elements.push_back(el);
+
+        ImportPhysMaterial mat;
+        mat.pdg_cutoffs[22] = {0.01, 0.1};
+        result.phys_materials.push_back(mat);
+
+        inp::Particle p;
+        p.name = "gamma";
+        p.pdg = pdg::gamma();
+        result.particles.push_back(p);
+
+        ImportProcess proc;
+        proc.particle_pdg = 22;
+        proc.process_class = ImportProcessClass::compton;
+        proc.models.push_back({});
+        proc.models.back().model_class = ImportModelClass::klein_nishina;
+        proc.lambda.grids.push_back({});
+        proc.lambda.grids.back().x = {-1, 2};
+        proc.lambda.grids.back().y = {1, 2, 3};
+        result.processes.push_back(proc);
+
+        inp::TwodGrid sb;
+        sb.x = {1, 2};
+        sb.y = {3};
+        sb.value = {4, 5};
+        result.seltzer_berger.atomic_xs[AtomicNumber{1}] = sb;
+
+        inp::ScintillationMaterial scint;
+        scint.components.push_back({});
+        scint.components.back().spectrum_distribution
+            = inp::NormalDistribution{400, 10};
+        result.optical_physics.gen.scintillation.emplace();
+        result.optical_physics.gen.scintillation->materials[OptMatId{0}]
+            = scint;
+
+        inp::OpticalRayleighAnalytic rayl;
+        rayl.scale_factor = 2;
+        rayl.compressibility = 0.5;
+        result.optical_physics.bulk.rayleigh.materials[OptMatId{1}].mfp
+            = rayl;
+
+        result.mucf_physics = inp::MucfPhysics::from_default();
+        return result;
+    }
+};
+
+TEST_F(ImportDataCacheTest, round_trip)
+{
+    std::string const filename = this->make_unique_filename(".bin");
+    EXPECT_FALSE(read_import_cache(filename + ".missing", 1234));
+
+    ImportData const orig = this->make_data();
+    write_import_cache(filename, 1234, orig);
+
+    // Different inputs
+    EXPECT_FALSE(read_import_cache(filename, 4321));
+
+    auto cached = read_import_cache(filename, 1234);
+    ASSERT_TRUE(cached);
+    ImportData const& data = *cached;
+
+    EXPECT_EQ("cgs", data.units);
+    ASSERT_EQ(1, data.elements.size());
+    EXPECT_EQ("H", data.elements[0].name);
+    EXPECT_EQ(1, data.elements[0].isotopes_fractions.size());
+    ASSERT_EQ(1, data.phys_materials.size());
+    EXPECT_EQ(0.1, data.phys_materials[0].pdg_cutoffs.at(22).range);
+    ASSERT_EQ(1, data.particles.size());
+    EXPECT_EQ(pdg::gamma(), data.particles[0].pdg);
+    ASSERT_EQ(1, data.processes.size());
+    EXPECT_EQ(ImportProcessClass::compton, data.processes[0].process_class);
+    ASSERT_EQ(1, data.processes[0].models.size());
+    EXPECT_EQ(ImportModelClass::klein_nishina,
+              data.processes[0].models[0].model_class);
+    ASSERT_EQ(1, data.processes[0].lambda.grids.size());
+    EXPECT_EQ(3, data.processes[0].lambda.grids[0].y.size());
+    EXPECT_EQ(2, data.processes[0].lambda.grids[0].x[Bound::hi]);
+    EXPECT_EQ(orig.seltzer_berger.atomic_xs, data.seltzer_berger.atomic_xs);
+
+    auto const& opt = data.optical_physics;
+    ASSERT_TRUE(opt.gen.scintillation);
+    EXPECT_FALSE(opt.gen.cherenkov);
+    auto const& scint = opt.gen.scintillation->materials.at(OptMatId{0});
+    ASSERT_EQ(1, scint.components.size());
+    auto const* normal = std::get_if<inp::NormalDistribution>(
+        &scint.components[0].spectrum_distribution);
+    ASSERT_TRUE(normal);
+    EXPECT_EQ(400, normal->mean);
+    EXPECT_EQ(10, normal->stddev);
+    auto const& rayl = std::get<inp::OpticalRayleighAnalytic>(
+        opt.bulk.rayleigh.materials.at(OptMatId{1}).mfp);
+    EXPECT_EQ(2, rayl.scale_factor);
+    EXPECT_EQ(0.5, rayl.compressibility);
+
+    EXPECT_TRUE(data.mucf_physics);
+    EXPECT_EQ(orig.mucf_physics.cycle_rates.size(),
+              data.mucf_physics.cycle_rates.size());
+    EXPECT_EQ(orig.mucf_physics.muon_energy_cdf.y,
+              data.mucf_physics.muon_energy_cdf.y);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
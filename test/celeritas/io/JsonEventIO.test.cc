@@ -4,8 +4,16 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/io/JsonEventIO.test.cc
 //---------------------------------------------------------------------------//
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 #include "celeritas/io/JsonEventReader.hh"
 #include "celeritas/io/JsonEventWriter.hh"
+#include "celeritas/io/PrefetchEventReader.hh"
+#include "celeritas/phys/Primary.hh"
 
 #include "EventIOTestBase.hh"
 #include "celeritas_test.hh"
@@ -20,6 +28,51 @@ class JsonEventIOTest : public EventIOTestBase
 {
 };
 
+//---------------------------------------------------------------------------//
+//! Read a fixed number of single-primary events, then fail
+class FailingEventReader final : public EventReaderInterface
+{
+  public:
+    explicit FailingEventReader(size_type num_good) : num_good_{num_good} {}
+
+    result_type operator()() final
+    {
+        if (num_read_ == num_good_)
+        {
+            throw std::runtime_error("failed to read event");
+        }
+        ++num_read_;
+        return result_type(1);
+    }
+
+    size_type num_events() const final { return num_good_ + 1; }
+
+  private:
+    size_type num_good_;
+    size_type num_read_{0};
+};
+
+//---------------------------------------------------------------------------//
+//! Read an unlimited number of single-primary events, counting the reads
+class CountingEventReader final : public EventReaderInterface
+{
+  public:
+    result_type operator()() final
+    {
+        ++num_read_;
+        return result_type(1);
+    }
+
+    size_type num_events() const final { return 0; }
+
+    size_type num_read() const { return num_read_.load(); }
+
+  private:
+    std::atomic<size_type> num_read_{0};
+};
+
+//---------------------------------------------------------------------------//
+
 TEST_F(JsonEventIOTest, write_read)
 {
     std::string filename = this->make_unique_filename(".jsonl");
@@ -35,6 +88,111 @@ TEST_F(JsonEventIOTest, write_read)
     this->read_check_test_event(reader);
 }
 
+TEST_F(JsonEventIOTest, prefetch)
+{
+    std::string filename = this->make_unique_filename(".jsonl");
+
+    // Write events
+    {
+        JsonEventWriter write_event(filename, this->particles());
+        this->write_test_event(std::ref(write_event));
+    }
+
+    {
+        // Read through a buffer smaller than the number of events
+        PrefetchEventReader reader(
+            std::make_unique<JsonEventReader>(filename, this->particles()), 1);
+        EXPECT_EQ(3, reader.num_events());
+        EXPECT_EQ(1, reader.capacity());
+        this->read_check_test_event(reader);
+        EXPECT_TRUE(reader().empty());
+    }
+    {
+        // Destroy before all events are consumed
+        PrefetchEventReader reader(
+            std::make_unique<JsonEventReader>(filename, this->particles()), 2);
+        EXPECT_FALSE(reader().empty());
+    }
+}
+
+TEST_F(JsonEventIOTest, prefetch_capacity)
+{
+    auto counting = std::make_unique<CountingEventReader>();
+    CountingEventReader const& counter = *counting;
+    PrefetchEventReader reader(std::move(counting), 2);
+
+    // Wait for the background thread to fill the buffer
+    auto wait_for_reads = [&counter](size_type num_read) {
+        for (int i = 0; i < 1000 && counter.num_read() < num_read; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        // Give the reader a chance to read too many events
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return counter.num_read();
+    };
+
+    // No more than the capacity is read ahead of the consumer
+    EXPECT_EQ(2, wait_for_reads(2));
+    EXPECT_FALSE(reader().empty());
+    EXPECT_EQ(3, wait_for_reads(3));
+    EXPECT_FALSE(reader().empty());
+    EXPECT_FALSE(reader().empty());
+    EXPECT_EQ(5, wait_for_reads(5));
+}
+
+TEST_F(JsonEventIOTest, prefetch_error)
+{
+    {
+        // Events read before the failure are still delivered
+        PrefetchEventReader reader(std::make_unique<FailingEventReader>(2), 1);
+        EXPECT_FALSE(reader().empty());
+        EXPECT_FALSE(reader().empty());
+        EXPECT_THROW(reader(), std::runtime_error);
+
+        // The error is reported once, after which the reader is exhausted
+        EXPECT_TRUE(reader().empty());
+        EXPECT_TRUE(reader().empty());
+    }
+    {
+        // Concurrent consumers: exactly one sees the error
+        constexpr size_type num_good = 20;
+        constexpr int num_threads = 4;
+        PrefetchEventReader reader(
+            std::make_unique<FailingEventReader>(num_good), 3);
+
+        std::atomic<size_type> num_events{0};
+        std::atomic<int> num_errors{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back([&] {
+                while (true)
+                {
+                    try
+                    {
+                        if (reader().empty())
+                        {
+                            break;
+                        }
+                        ++num_events;
+                    }
+                    catch (std::runtime_error const&)
+                    {
+                        ++num_errors;
+                    }
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        EXPECT_EQ(num_good, num_events.load());
+        EXPECT_EQ(1, num_errors.load());
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -40,6 +40,7 @@ class OpticalDistributionIOTest : public Test
         data.step_length = 0.2;
         data.charge = units::ElementaryCharge{-1};
         data.material = OptMatId(0);
+        data.weight = 2;
         data.continuous_edep_fraction = 1;
         data.points[StepPoint::pre] = {Speed(0.7), 0, Real3{0, 0, 0}};
         data.points[StepPoint::post] = {Speed(0.6), 1e-11, Real3{0, 0, 0.2}};
@@ -74,6 +75,7 @@ TEST_F(OpticalDistributionIOTest, write_read)
         EXPECT_EQ(d.type, r.type);
         EXPECT_EQ(d.num_photons, r.num_photons);
         EXPECT_EQ(d.primary, r.primary);
+        EXPECT_EQ(d.weight, r.weight);
         EXPECT_EQ(d.step_length, r.step_length);
         EXPECT_EQ(d.charge, r.charge);
         EXPECT_EQ(d.material, r.material);
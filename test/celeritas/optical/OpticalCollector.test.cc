@@ -478,6 +478,10 @@ TEST_F(LArSphereOffloadTest, host_generate_small)
         constexpr unsigned int expected_step_iters = 4;
         EXPECT_EQ(expected_steps, result.accum.steps);
         EXPECT_EQ(expected_step_iters, result.accum.step_iters);
+        EXPECT_EQ(expected_step_iters * input_.num_track_slots,
+                  result.accum.slot_iters);
+        EXPECT_LT(0, result.accum.tail_step_iters);
+        EXPECT_GE(expected_step_iters, result.accum.tail_step_iters);
         EXPECT_EQ(1, result.accum.flushes);
         ASSERT_EQ(1, result.accum.generators.size());
 
@@ -488,6 +492,33 @@ TEST_F(LArSphereOffloadTest, host_generate_small)
     }
 }
 
+TEST_F(LArSphereOffloadTest, host_generate_interleaved)
+{
+    input_.num_track_slots = 32;
+    input_.buffer_capacity = 4096;
+    input_.auto_flush = 1;
+    input_.interleave_step_iters = 2;
+    this->build_optical_collector();
+
+    primary_energy_ = units::MevEnergy{0.01};
+
+    size_type primaries = 4;
+    size_type core_track_slots = 2;
+    size_type steps = 3;
+    auto result = this->run<MemSpace::host>(primaries, core_track_slots, steps);
+
+    // Optical steps are taken alongside the core loop, at most two optical
+    // step iterations per core step
+    EXPECT_GT(result.accum.step_iters, 0);
+    EXPECT_LE(result.accum.step_iters, 2 * steps);
+    EXPECT_EQ(result.accum.step_iters * input_.num_track_slots,
+              result.accum.slot_iters);
+    EXPECT_GT(result.accum.steps, 0);
+    EXPECT_LE(result.accum.steps, result.accum.slot_iters);
+    ASSERT_EQ(1, result.accum.generators.size());
+    EXPECT_GT(result.accum.generators[0].num_generated, 0);
+}
+
 TEST_F(LArSphereOffloadTest, host_generate)
 {
     input_.num_track_slots = 262144;
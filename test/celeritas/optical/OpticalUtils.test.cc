@@ -8,16 +8,20 @@
 
 #include <memory>
 #include <numeric>
+#include <random>
 #include <vector>
 
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
+#include "celeritas/optical/action/detail/RussianRoulette.hh"
 #include "celeritas/optical/action/detail/TrackInitAlgorithms.hh"
 #include "celeritas/optical/gen/detail/GeneratorAlgorithms.hh"
+#include "celeritas/optical/gen/detail/PhotonScaler.hh"
 
 #include "celeritas_test.hh"
 
@@ -178,6 +182,86 @@ TEST(OpticalUtilsTest, TEST_IF_CELER_DEVICE(copy_if_vacant_device))
     EXPECT_VEC_EQ(expected_vacancies, vacancies);
 }
 
+TEST(OpticalUtilsTest, photon_scaler)
+{
+    using celeritas::detail::PhotonScaler;
+
+    std::mt19937 rng;
+    optical::GeneratorDistributionData dist;
+    dist.num_photons = 1000;
+
+    // Unit scale doesn't change the distribution
+    PhotonScaler{1}(rng, &dist);
+    EXPECT_EQ(1000, dist.num_photons);
+    EXPECT_EQ(1, dist.weight);
+
+    // Total weight is preserved on average
+    size_type const num_samples = 4000;
+    for (real_type scale : {3, 250, 5000})
+    {
+        real_type total_weight = 0;
+        size_type num_cleared = 0;
+        for ([[maybe_unused]] auto i : range(num_samples))
+        {
+            auto scaled = dist;
+            PhotonScaler{scale}(rng, &scaled);
+            if (scaled.num_photons == 0)
+            {
+                ++num_cleared;
+                continue;
+            }
+            EXPECT_EQ(scale, scaled.weight);
+            EXPECT_LE(scaled.num_photons, std::ceil(1000 / scale));
+            total_weight += scaled.num_photons * scaled.weight;
+        }
+        EXPECT_SOFT_NEAR(1000, total_weight / num_samples, 0.1)
+            << "scale=" << scale;
+        if (scale < 1000)
+        {
+            EXPECT_EQ(0, num_cleared);
+        }
+    }
+}
+
+TEST(OpticalUtilsTest, russian_roulette)
+{
+    using optical::detail::RussianRoulette;
+
+    std::mt19937 rng;
+
+    // Certain survival doesn't change the weight
+    real_type weight = 2;
+    EXPECT_TRUE(RussianRoulette{1}(rng, &weight));
+    EXPECT_EQ(2, weight);
+
+    // Survivors are scaled by 1/p and the expected weight is preserved
+    size_type const num_samples = 4000;
+    for (real_type survival : {0.5, 0.1})
+    {
+        real_type total_weight = 0;
+        size_type num_killed = 0;
+        for ([[maybe_unused]] auto i : range(num_samples))
+        {
+            real_type w = 2;
+            if (!RussianRoulette{survival}(rng, &w))
+            {
+                // Killed photon's weight is unchanged
+                EXPECT_EQ(2, w);
+                ++num_killed;
+                continue;
+            }
+            EXPECT_SOFT_EQ(2 / survival, w);
+            total_weight += w;
+        }
+        EXPECT_SOFT_NEAR(1 - survival,
+                         static_cast<real_type>(num_killed) / num_samples,
+                         0.1)
+            << "survival=" << survival;
+        EXPECT_SOFT_NEAR(2, total_weight / num_samples, 0.1)
+            << "survival=" << survival;
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -0,0 +1,129 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/EventQueue.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/EventQueue.hh"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+using VecPrimary = EventQueue::VecPrimary;
+using units::MevEnergy;
+
+//! Create events with the given primary energies
+std::vector<VecPrimary>
+make_events(std::vector<std::vector<double>> const& energies)
+{
+    std::vector<VecPrimary> result(energies.size());
+    for (auto i : range(energies.size()))
+    {
+        for (double e : energies[i])
+        {
+            Primary p;
+            p.energy = MevEnergy{e};
+            result[i].push_back(p);
+        }
+    }
+    return result;
+}
+
+//! Claim all events from the queue sequentially
+std::vector<int> claim_all(EventQueue& next_event)
+{
+    std::vector<int> result;
+    while (auto event = next_event())
+    {
+        result.push_back(static_cast<int>(event.get()));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(EventQueueTest, input_order)
+{
+    auto events = make_events({{1}, {10, 10}, {}, {5}});
+    EventQueue next_event(make_span(events), /* largest_first = */ false);
+    EXPECT_EQ(4, next_event.size());
+
+    static int const expected[] = {0, 1, 2, 3};
+    EXPECT_VEC_EQ(expected, claim_all(next_event));
+
+    // Queue stays exhausted
+    EXPECT_FALSE(next_event());
+}
+
+TEST(EventQueueTest, largest_first)
+{
+    // Total energies: 1, 20, 0, 5, 20, 1
+    auto events = make_events({{1}, {10, 10}, {}, {5}, {20}, {0.5, 0.5}});
+    EventQueue next_event(make_span(events), /* largest_first = */ true);
+
+    // Ties are handed out in input order
+    static int const expected[] = {1, 4, 3, 0, 5, 2};
+    EXPECT_VEC_EQ(expected, claim_all(next_event));
+    EXPECT_FALSE(next_event());
+}
+
+TEST(EventQueueTest, empty)
+{
+    std::vector<VecPrimary> events;
+    EventQueue next_event(make_span(events), /* largest_first = */ true);
+    EXPECT_EQ(0, next_event.size());
+    EXPECT_FALSE(next_event());
+}
+
+TEST(EventQueueTest, concurrent)
+{
+    constexpr size_type num_events = 1000;
+    constexpr size_type num_threads = 4;
+    std::vector<VecPrimary> events(num_events, make_events({{1}}).front());
+    EventQueue next_event(make_span(events), /* largest_first = */ false);
+
+    // Claim events from multiple threads
+    std::vector<std::vector<int>> claimed(num_threads);
+    std::vector<std::thread> threads;
+    for (auto i : range(num_threads))
+    {
+        threads.emplace_back(
+            [&next_event, &result = claimed[i]] {
+                result = claim_all(next_event);
+            });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // Each event is claimed exactly once
+    std::vector<int> all_events;
+    for (auto const& c : claimed)
+    {
+        // Each thread claims its events in increasing order
+        EXPECT_TRUE(std::is_sorted(c.begin(), c.end()));
+        all_events.insert(all_events.end(), c.begin(), c.end());
+    }
+    std::sort(all_events.begin(), all_events.end());
+    std::vector<int> expected(num_events);
+    for (auto i : range(num_events))
+    {
+        expected[i] = static_cast<int>(i);
+    }
+    EXPECT_VEC_EQ(expected, all_events);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
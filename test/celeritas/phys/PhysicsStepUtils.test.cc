@@ -40,7 +40,12 @@ class PhysicsStepUtilsTest : public MockTestBase
 
     using MevEnergy = units::MevEnergy;
 
-    PhysicsOptions build_physics_options() const override { return {}; }
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.count_xs_cache = true;
+        return opts;
+    }
 
     void SetUp() override
     {
@@ -209,6 +214,54 @@ TEST_F(PhysicsStepUtilsTest, calc_physics_step_limit)
     }
 }
 
+TEST_F(PhysicsStepUtilsTest, xs_cache)
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+    PhysicsStepView pstep = this->step_view();
+
+    auto const& hits = phys_state.ref().xs_cache_hits[TrackSlotId{0}];
+    auto const& misses = phys_state.ref().xs_cache_misses[TrackSlotId{0}];
+    EXPECT_EQ(0u, hits);
+    EXPECT_EQ(0u, misses);
+
+    PhysicsTrackView phys = this->init_track(
+        &material, PhysMatId{1}, &particle, "celeriton", MevEnergy{10});
+    phys.interaction_mfp(1e-4);
+    StepLimit step = calc_physics_step_limit(material, particle, phys, pstep);
+    EXPECT_SOFT_EQ(1.e-4 / 9.e-3, to_cm(step.step));
+    EXPECT_EQ(0u, hits);
+    EXPECT_EQ(1u, misses);
+
+    // Same particle, material, and energy: cross sections are reused
+    step = calc_physics_step_limit(material, particle, phys, pstep);
+    EXPECT_SOFT_EQ(1.e-4 / 9.e-3, to_cm(step.step));
+    EXPECT_EQ(1u, hits);
+    EXPECT_EQ(1u, misses);
+
+    // Changing the material recalculates
+    material = MaterialTrackView::Initializer_t{PhysMatId{2}};
+    PhysicsTrackView new_phys(this->physics()->host_ref(),
+                              phys_state.ref(),
+                              particle,
+                              material.material_id(),
+                              TrackSlotId{0});
+    step = calc_physics_step_limit(material, particle, new_phys, pstep);
+    EXPECT_SOFT_EQ(1.e-4 / 9.e-1, to_cm(step.step));
+    EXPECT_EQ(1u, hits);
+    EXPECT_EQ(2u, misses);
+
+    // Initializing a new track invalidates the cache
+    new_phys = PhysicsTrackView::Initializer_t{};
+    new_phys.interaction_mfp(1e-4);
+    step = calc_physics_step_limit(material, particle, new_phys, pstep);
+    EXPECT_SOFT_EQ(1.e-4 / 9.e-1, to_cm(step.step));
+    EXPECT_EQ(1u, hits);
+    EXPECT_EQ(3u, misses);
+}
+
 TEST_F(PhysicsStepUtilsTest, calc_mean_energy_loss)
 {
     MaterialTrackView material(
@@ -6,8 +6,10 @@
 //---------------------------------------------------------------------------//
 #include <algorithm>
 #include <memory>
+#include <set>
 #include <vector>
 
+#include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/io/LogContextException.hh"
 #include "corecel/sys/ActionRegistry.hh"
@@ -15,7 +17,11 @@
 #include "celeritas/TestEm3Base.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/ext/GeantPhysicsOptions.hh"
+#include "celeritas/geo/CoreGeoParams.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/ActionLauncher.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/global/Stepper.hh"
@@ -164,6 +170,21 @@ class TestTrackSortActionIdEm3Stepper : public TestEm3NoMsc
     }
 };
 
+#define TestTrackSortVolumeEm3Stepper \
+    TEST_IF_CELERITAS_GEANT(TestTrackSortVolumeEm3Stepper)
+class TestTrackSortVolumeEm3Stepper : public TestEm3NoMsc
+{
+  protected:
+    auto build_init() -> SPConstTrackInit override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::reindex_volume;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
 #define TestActionCountEm3Stepper \
     TEST_IF_CELERITAS_GEANT(TestActionCountEm3Stepper)
 template<MemSpace M>
@@ -270,6 +291,64 @@ TEST_F(TestEm3NoMsc, host_is_sorting)
     }
 }
 
+TEST_F(TestEm3NoMsc, host_launch_action_range)
+{
+    CoreState<MemSpace::host> state{*this->core(), StreamId{0}, 128};
+
+    this->init_from_primaries(state, state.size());
+    this->step_action("pre-step", state);
+    this->step_action("sort-tracks-post-step", state);
+    ASSERT_TRUE(state.has_action_range());
+
+    auto const& track_slots = state.ref().track_slots;
+    auto const& post_step_action = state.ref().sim.post_step_action;
+    auto const& action_reg = *this->action_reg();
+
+    size_type total_launched{0};
+    size_type num_post_actions{0};
+    for (auto aidx : range(action_reg.num_actions()))
+    {
+        ActionId action_id{aidx};
+        auto const* action = dynamic_cast<CoreStepActionInterface const*>(
+            action_reg.action(action_id).get());
+        if (!action || action->order() != StepActionOrder::post)
+        {
+            continue;
+        }
+        ++num_post_actions;
+
+        // Record the action of every track visited by the launcher
+        std::vector<ActionId> visited(state.size());
+        launch_action(*action, *this->core(), state, [&](ThreadId tid) {
+            visited[tid.get()]
+                = post_step_action[TrackSlotId{track_slots[tid]}];
+        });
+
+        size_type num_launched{0};
+        for (auto i : range(state.size()))
+        {
+            if (visited[i])
+            {
+                EXPECT_EQ(action_id, visited[i])
+                    << "thread " << i << " launched for '" << action->label()
+                    << "' does not have the correct action";
+                ++num_launched;
+            }
+        }
+        EXPECT_EQ(state.get_action_range(action_id).size(), num_launched);
+        total_launched += num_launched;
+    }
+    // Each thread is launched by at most one post-step action
+    EXPECT_LE(total_launched, state.size());
+
+    // Launching over the full state would visit every slot for every action
+    auto const& counts = state.action_launch_counts();
+    EXPECT_EQ(total_launched, counts.visited);
+    EXPECT_EQ(num_post_actions * state.size(),
+              counts.visited + counts.skipped);
+    EXPECT_GT(counts.skipped, 0);
+}
+
 TEST_F(TestTrackPartitionEm3Stepper, host_is_partitioned)
 {
     // Create stepper and primaries, and take a step
@@ -392,6 +471,63 @@ TEST_F(TestTrackSortActionIdEm3Stepper, host_is_sorted)
     }
 }
 
+TEST_F(TestTrackSortVolumeEm3Stepper, host_is_grouped)
+{
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    step(make_span(primaries));
+
+    auto& state = dynamic_cast<CoreState<MemSpace::host>&>(*step.sp_state());
+    auto const& params_ref = this->core()->host_ref();
+    size_type const num_volumes
+        = this->core()->geometry()->impl_volumes().size();
+
+    // Volume key: inactive and outside tracks are placed last
+    auto get_volume = [&](TrackSlotId::size_type slot) -> size_type {
+        if (state.ref().sim.status[TrackSlotId{slot}] == TrackStatus::inactive)
+        {
+            return num_volumes;
+        }
+        GeoTrackView geo{
+            params_ref.geometry, state.ref().geometry, TrackSlotId{slot}};
+        if (geo.is_outside())
+        {
+            return num_volumes;
+        }
+        return geo.impl_volume_id().unchecked_get();
+    };
+
+    std::set<size_type> all_volumes;
+    for (auto i = 0; i < 10; ++i)
+    {
+        // Expected order is a stable sort of the current permutation
+        std::vector<TrackSlotId::size_type> expected(state.size());
+        for (auto tid : range(ThreadId{state.size()}))
+        {
+            expected[tid.get()] = state.ref().track_slots[tid];
+        }
+        std::stable_sort(expected.begin(),
+                         expected.end(),
+                         [&get_volume](auto left, auto right) {
+                             return get_volume(left) < get_volume(right);
+                         });
+
+        detail::sort_tracks_by_volume(*this->core(), state);
+
+        std::vector<TrackSlotId::size_type> actual(state.size());
+        for (auto tid : range(ThreadId{state.size()}))
+        {
+            actual[tid.get()] = state.ref().track_slots[tid];
+            all_volumes.insert(get_volume(actual[tid.get()]));
+        }
+        EXPECT_VEC_EQ(expected, actual) << "after step " << i;
+        step();
+    }
+
+    // Tracks spread over several volumes
+    EXPECT_LT(2, all_volumes.size());
+}
+
 TEST_F(TestTrackSortActionIdEm3Stepper, TEST_IF_CELER_DEVICE(device_is_sorted))
 {
     // Initialize some primaries and take a step
@@ -453,7 +589,10 @@ TEST_F(TestActionCountEm3StepperH, host_count_actions)
     // can't access the collection in CoreState, so test do the counting in a
     // temporary instead
     HostActionThreads buffer;
+    HostActionThreads sorted_buffer;
     resize(&buffer, num_actions + 1);
+    resize(&sorted_buffer, num_actions + 1);
+    detail::TrackSortScratch scratch;
 
     auto loop = [&] {
         detail::sort_tracks(step.state_ref(),
@@ -464,6 +603,17 @@ TEST_F(TestActionCountEm3StepperH, host_count_actions)
                                         TrackOrder::reindex_step_limit_action);
 
         check_action_count(buffer, step.state().size());
+
+        // Sorting while counting gives the same offsets
+        detail::sort_tracks(step.state_ref(),
+                            TrackOrder::reindex_step_limit_action,
+                            sorted_buffer[AllActionThreads{}],
+                            scratch);
+        for (auto i : range(num_actions + 1))
+        {
+            EXPECT_EQ(buffer[ActionId{i}].unchecked_get(),
+                      sorted_buffer[ActionId{i}].unchecked_get());
+        }
         step();
     };
 
@@ -0,0 +1,110 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/BlockedAlgorithms.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/track/detail/BlockedAlgorithms.hh"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+std::vector<size_type> make_counts(size_type size)
+{
+    std::mt19937 rng;
+    std::uniform_int_distribution<size_type> sample(0, 3);
+    std::vector<size_type> result(size);
+    for (auto& v : result)
+    {
+        v = sample(rng);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(BlockedAlgorithmsTest, exclusive_scan)
+{
+    for (size_type size : {0u, 1u, 3u, 1000u, 50001u})
+    {
+        auto actual = make_counts(size);
+        auto expected = actual;
+        size_type acc = 0;
+        for (auto& v : expected)
+        {
+            size_type current = v;
+            v = acc;
+            acc += current;
+        }
+
+        // Result is the last element of the scan, excluding the last input
+        size_type last = blocked_exclusive_scan(actual.data(), size);
+        EXPECT_EQ(size > 0 ? expected.back() : 0, last) << "size=" << size;
+        EXPECT_TRUE(expected == actual) << "size=" << size;
+    }
+}
+
+TEST(BlockedAlgorithmsTest, transform_inclusive_scan)
+{
+    for (size_type size : {0u, 1u, 3u, 1000u, 50001u})
+    {
+        auto input = make_counts(size);
+        std::vector<size_type> expected(size);
+        size_type acc = 0;
+        for (auto i : range(size))
+        {
+            acc += 2 * input[i];
+            expected[i] = acc;
+        }
+
+        std::vector<size_type> actual(size);
+        size_type total = blocked_transform_inclusive_scan(
+            input.data(), actual.data(), size, [](size_type v) {
+                return 2 * v;
+            });
+        EXPECT_EQ(acc, total) << "size=" << size;
+        EXPECT_TRUE(expected == actual) << "size=" << size;
+    }
+}
+
+TEST(BlockedAlgorithmsTest, stable_partition)
+{
+    auto is_odd = [](size_type v) { return v % 2 != 0; };
+
+    for (size_type size : {0u, 1u, 3u, 1000u, 50001u})
+    {
+        // Tag each value with its index so that stability is checked
+        auto actual = make_counts(size);
+        for (auto i : range(size))
+        {
+            actual[i] += 4 * i;
+        }
+        auto expected = actual;
+        auto expected_num_true = static_cast<size_type>(
+            std::stable_partition(expected.begin(), expected.end(), is_odd)
+            - expected.begin());
+
+        size_type num_true
+            = blocked_stable_partition(actual.data(), size, is_odd);
+        EXPECT_EQ(expected_num_true, num_true) << "size=" << size;
+        EXPECT_TRUE(expected == actual) << "size=" << size;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,175 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSortUtils.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/track/detail/TrackSortUtils.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "corecel/Config.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Minimal host states: only the data used to sort by particle type.
+ */
+struct SortStates
+{
+    template<class T>
+    using Items = StateCollection<T, Ownership::value, MemSpace::host>;
+    template<class T>
+    using ThreadItems
+        = Collection<T, Ownership::value, MemSpace::host, ThreadId>;
+
+    Items<ParticleId> particle_id;
+    ThreadItems<TrackSlotId::size_type> track_slots;
+
+    explicit SortStates(std::vector<ParticleId> const& particles)
+    {
+        make_builder(&particle_id).insert_back(particles.begin(),
+                                               particles.end());
+        resize(&track_slots, particle_id.size());
+        auto* slots = track_slots.data().get();
+        std::iota(slots, slots + track_slots.size(), TrackSlotId::size_type{0});
+    }
+
+    HostRef<CoreStateData> ref()
+    {
+        HostRef<CoreStateData> result;
+        result.particles.particle_id = particle_id;
+        result.track_slots = track_slots;
+        return result;
+    }
+
+    std::vector<TrackSlotId::size_type> sorted_slots() const
+    {
+        auto const* slots = track_slots.data().get();
+        return {slots, slots + track_slots.size()};
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Particle types with empty slots interspersed
+std::vector<ParticleId> make_particles(size_type size, size_type offset)
+{
+    std::vector<ParticleId> result(size);
+    for (auto i : range(size))
+    {
+        auto key = (i * 7 + offset) % 4;
+        if (key < 3)
+        {
+            result[i] = ParticleId{key};
+        }
+    }
+    return result;
+}
+
+//! Expected stable sort by particle type with empty slots last
+std::vector<TrackSlotId::size_type>
+expected_slots(std::vector<ParticleId> const& particles)
+{
+    std::vector<TrackSlotId::size_type> result(particles.size());
+    std::iota(result.begin(), result.end(), TrackSlotId::size_type{0});
+    std::stable_sort(result.begin(), result.end(), [&](auto a, auto b) {
+        auto key = [&](auto slot) {
+            return particles[slot] ? particles[slot].get() : 3;
+        };
+        return key(a) < key(b);
+    });
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(TrackSortUtilsTest, particle_type)
+{
+    for (size_type size : {1u, 10u, 5000u})
+    {
+        auto particles = make_particles(size, 0);
+        SortStates states{particles};
+        sort_tracks(states.ref(), TrackOrder::reindex_particle_type);
+        EXPECT_TRUE(expected_slots(particles) == states.sorted_slots())
+            << "size=" << size;
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(TrackSortUtilsTest, reuse_scratch)
+{
+    TrackSortScratch scratch;
+    TrackSlotId::size_type const* sorted_data{nullptr};
+    for (size_type size : {5000u, 10u, 1000u})
+    {
+        auto particles = make_particles(size, 1);
+        SortStates states{particles};
+        sort_tracks(
+            states.ref(), TrackOrder::reindex_particle_type, {}, scratch);
+        EXPECT_TRUE(expected_slots(particles) == states.sorted_slots())
+            << "size=" << size;
+        if (!sorted_data)
+        {
+            sorted_data = scratch.sorted.data();
+        }
+        // Smaller sorts reuse the storage of the first one
+        EXPECT_EQ(sorted_data, scratch.sorted.data()) << "size=" << size;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort independent states from multiple threads.
+ *
+ * In event-parallel mode, each stream sorts its own tracks from inside the
+ * caller's parallel region.
+ */
+TEST(TrackSortUtilsTest, nested_region)
+{
+    constexpr int num_streams = 3;
+    std::vector<std::vector<TrackSlotId::size_type>> actual(num_streams);
+    std::vector<std::vector<TrackSlotId::size_type>> expected(num_streams);
+
+    MultiExceptionHandler capture_exception;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
+#    pragma omp parallel for num_threads(num_streams)
+#endif
+    for (int i = 0; i < num_streams; ++i)
+    {
+        CELER_TRY_HANDLE(
+            [&] {
+                auto particles = make_particles(5000, i);
+                SortStates states{particles};
+                sort_tracks(states.ref(), TrackOrder::reindex_particle_type);
+                actual[i] = states.sorted_slots();
+                expected[i] = expected_slots(particles);
+            }(),
+            capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
+
+    for (auto i : range(num_streams))
+    {
+        EXPECT_TRUE(expected[i] == actual[i]) << "stream " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
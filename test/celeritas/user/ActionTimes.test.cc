@@ -0,0 +1,102 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/ActionTimes.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/user/ActionTimes.hh"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/AuxParamsRegistry.hh"
+#include "corecel/data/AuxStateVec.hh"
+#include "corecel/sys/ActionInterface.hh"
+#include "corecel/sys/ActionRegistry.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ActionTimesTest : public ::celeritas::test::Test
+{
+  protected:
+    using MapStrDbl = ActionTimes::MapStrDbl;
+
+    void SetUp() override
+    {
+        actions_ = std::make_shared<ActionRegistry>();
+        for (char const* label : {"alpha", "beta", "gamma"})
+        {
+            actions_->insert(std::make_shared<StaticConcreteAction>(
+                actions_->next_id(), label, "test action"));
+        }
+        aux_ = std::make_shared<AuxParamsRegistry>();
+    }
+
+    //! Time a sleeping "beta" action for several steps
+    MapStrDbl run(MemSpace m, bool sync_stream)
+    {
+        auto times = ActionTimes::make_and_insert(
+            actions_, aux_, "action-times", sync_stream);
+        AuxStateVec aux_state(*aux_, m, StreamId{0}, 1);
+        auto& state = times->state(aux_state);
+
+        for ([[maybe_unused]] int step : range(6))
+        {
+            state.mark();
+            state.record(ActionId{0});
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            state.record(ActionId{1});
+            state.end_step();
+        }
+        return times->get_action_times(aux_state);
+    }
+
+    std::shared_ptr<ActionRegistry> actions_;
+    std::shared_ptr<AuxParamsRegistry> aux_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ActionTimesTest, host)
+{
+    auto result = this->run(MemSpace::host, false);
+    EXPECT_EQ(0u, result.count("gamma"));
+    ASSERT_EQ(1u, result.count("beta"));
+    EXPECT_GE(result["beta"], 6 * 0.002);
+    EXPECT_LT(result["alpha"], result["beta"]);
+}
+
+TEST_F(ActionTimesTest, TEST_IF_CELER_DEVICE(device_sync))
+{
+    auto result = this->run(MemSpace::device, true);
+    ASSERT_EQ(1u, result.count("beta"));
+    EXPECT_GE(result["beta"], 6 * 0.002);
+}
+
+TEST_F(ActionTimesTest, TEST_IF_CELER_DEVICE(device_events))
+{
+    // No kernels are launched, so the elapsed device time is small but all
+    // pending steps are read back
+    auto result = this->run(MemSpace::device, false);
+    EXPECT_EQ(0u, result.count("gamma"));
+    for (auto const& [label, time] : result)
+    {
+        EXPECT_GE(time, 0) << label;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,201 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/SharedHostParams.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/SharedHostParams.hh"
+
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/ParamsDataStore.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/SharedMemorySegment.hh"
+
+#include "Collection.test.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Whether the data is inside the segment
+bool is_inside(void const* data, SharedMemorySegment const& segment)
+{
+    auto const* ptr = static_cast<std::byte const*>(data);
+    auto span = segment.data();
+    return ptr >= span.data() && ptr < span.data() + span.size();
+}
+
+//---------------------------------------------------------------------------//
+
+class SharedHostParamsTest : public Test
+{
+  protected:
+    void SetUp() override
+    {
+        host_data_.max_element_components = 3;
+        auto el_builder = make_builder(&host_data_.elements);
+        auto mat_builder = make_builder(&host_data_.materials);
+
+        MockMaterial m;
+        m.number_density = 2.0;
+        m.elements = el_builder.insert_back({{1, 1.1}, {3, 5.0}, {6, 12.0}});
+        mat_builder.push_back(m);
+        m.number_density = 20.0;
+        m.elements = el_builder.insert_back({{10, 20.0}});
+        mat_builder.push_back(m);
+    }
+
+    void TearDown() override
+    {
+        // Disable global sharing
+        shared_host_params() = SharedHostParams{};
+    }
+
+    //! Check that the reference has the original data
+    void check_ref(HostCRef<MockParamsData> const& ref)
+    {
+        ASSERT_EQ(2, ref.materials.size());
+        ASSERT_EQ(4, ref.elements.size());
+        EXPECT_EQ(3, ref.max_element_components);
+        auto const& mat = ref.materials[MockMaterialId{1}];
+        EXPECT_EQ(20.0, mat.number_density);
+        auto els = ref.elements[mat.elements];
+        ASSERT_EQ(1, els.size());
+        EXPECT_EQ(10, els[0].atomic_number);
+        EXPECT_EQ(20.0, els[0].atomic_mass);
+    }
+
+    HostVal<MockParamsData> host_data_;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST(SharedMemorySegmentTest, create_attach)
+{
+    std::string name = "/celeritas-test-" + std::to_string(getpid());
+    char const message[] = "hello shared world";
+    {
+        SharedMemorySegment created{name, sizeof(message)};
+        EXPECT_TRUE(created.owner());
+        EXPECT_EQ(sizeof(message), created.data().size());
+        std::memcpy(created.mutable_data().data(), message, sizeof(message));
+
+        SharedMemorySegment attached{name};
+        EXPECT_FALSE(attached.owner());
+        ASSERT_EQ(sizeof(message), attached.data().size());
+        EXPECT_EQ(0,
+                  std::memcmp(attached.data().data(), message, sizeof(message)));
+
+        // Attached segment stays valid after unlinking
+        created.unlink();
+        EXPECT_THROW(SharedMemorySegment{name}, RuntimeError);
+        EXPECT_EQ(0,
+                  std::memcmp(attached.data().data(), message, sizeof(message)));
+    }
+    // Owner destruction removes the name
+    {
+        SharedMemorySegment created{name, 16};
+    }
+    EXPECT_THROW(SharedMemorySegment{name}, RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SharedHostParamsTest, disabled)
+{
+    EXPECT_FALSE(shared_host_params());
+    ParamsDataStore<MockParamsData> store{std::move(host_data_)};
+    this->check_ref(store.host_ref());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SharedHostParamsTest, share)
+{
+    SharedHostParams share{MpiCommunicator{}};
+    EXPECT_TRUE(share);
+
+    HostCRef<MockParamsData> ref;
+    auto segment = share([&] { ref = host_data_; });
+    ASSERT_TRUE(segment);
+    EXPECT_TRUE(segment->owner());
+    EXPECT_TRUE(is_inside(ref.elements.data().get(), *segment));
+    EXPECT_TRUE(is_inside(ref.materials.data().get(), *segment));
+    EXPECT_EQ(1, share.num_segments());
+    EXPECT_LE(4 * sizeof(MockElement) + 2 * sizeof(MockMaterial),
+              share.num_bytes());
+
+    // Local data can be released
+    host_data_ = {};
+    this->check_ref(ref);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SharedHostParamsTest, attach)
+{
+    using detail::CollectionRelocator;
+    using detail::ScopedCollectionRelocator;
+    using Mode = CollectionRelocator::Mode;
+
+    std::string name = "/celeritas-test-attach-" + std::to_string(getpid());
+
+    CollectionRelocator measure;
+    {
+        HostCRef<MockParamsData> ref;
+        ScopedCollectionRelocator scoped_relocate{&measure};
+        ref = host_data_;
+    }
+    ASSERT_LT(0, measure.size());
+
+    // Copy into the segment as the lowest rank would
+    SharedMemorySegment created{name, measure.size()};
+    {
+        HostCRef<MockParamsData> ref;
+        CollectionRelocator write{Mode::write, created.data()};
+        ScopedCollectionRelocator scoped_relocate{&write};
+        ref = host_data_;
+        EXPECT_EQ(measure.size(), write.size());
+        EXPECT_TRUE(is_inside(ref.elements.data().get(), created));
+    }
+
+    // Attach to a separate mapping as the other ranks would
+    SharedMemorySegment attached{name};
+    created.unlink();
+    HostCRef<MockParamsData> ref;
+    {
+        CollectionRelocator attach{Mode::attach, attached.data()};
+        ScopedCollectionRelocator scoped_relocate{&attach};
+        ref = host_data_;
+        EXPECT_EQ(measure.size(), attach.size());
+    }
+    EXPECT_TRUE(is_inside(ref.elements.data().get(), attached));
+    EXPECT_TRUE(is_inside(ref.materials.data().get(), attached));
+    EXPECT_FALSE(is_inside(ref.elements.data().get(), created));
+
+    // Attached data were written by the owner, not copied locally
+    host_data_ = {};
+    this->check_ref(ref);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SharedHostParamsTest, params_store)
+{
+    shared_host_params() = SharedHostParams{MpiCommunicator{}};
+
+    ParamsDataStore<MockParamsData> store{std::move(host_data_)};
+    EXPECT_TRUE(store);
+    this->check_ref(store.host_ref());
+    EXPECT_EQ(1, shared_host_params().num_segments());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
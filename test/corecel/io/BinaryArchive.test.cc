@@ -0,0 +1,199 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryArchive.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/io/BinaryArchive.hh"
+
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "corecel/OpaqueId.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/EnumArray.hh"
+#include "corecel/io/BinaryFile.hh"
+#include "corecel/math/Quantity.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+enum class Color
+{
+    red,
+    green,
+    blue,
+    size_
+};
+
+struct Meter
+{
+    static CELER_CONSTEXPR_FUNCTION double value() { return 100; }
+    static char const* label() { return "m"; }
+};
+
+using ThingId = OpaqueId<struct Thing_>;
+
+struct Empty
+{
+};
+
+struct Thing
+{
+    std::string name;
+    ThingId id;
+    Quantity<Meter, double> length;
+    std::vector<bool> flags;
+    std::optional<Array<int, 3>> counts;
+    std::variant<int, std::string, Empty> extra;
+    EnumArray<Color, std::vector<double>> spectra;
+};
+
+template<class Archive>
+void serialize(Archive& ar, Thing& t)
+{
+    ar(t.name, t.id, t.length, t.flags, t.counts, t.extra, t.spectra);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+class BinaryArchiveTest : public ::celeritas::test::Test
+{
+  protected:
+    std::map<int, Thing> make_things() const
+    {
+        std::map<int, Thing> result;
+
+        Thing t;
+        t.name = "first";
+        t.id = ThingId{3};
+        t.length = Quantity<Meter, double>{1.5};
+        t.flags = {true, false, true};
+        t.counts = Array<int, 3>{1, 2, 3};
+        t.extra = std::string{"extra"};
+        t.spectra[Color::green] = {0.5, 1.5};
+        result.emplace(10, t);
+
+        t = {};
+        t.name = "second";
+        t.extra = Empty{};
+        result.emplace(-2, t);
+        return result;
+    }
+};
+
+TEST_F(BinaryArchiveTest, round_trip)
+{
+    auto const things = this->make_things();
+    std::vector<Color> colors{Color::blue, Color::red};
+
+    std::string buffer;
+    BinaryWriter write{&buffer};
+    write(things, colors, 1.25, std::string{"done"});
+
+    std::map<int, Thing> read_things;
+    std::vector<Color> read_colors;
+    double value{};
+    std::string last;
+    BinaryReader read{{reinterpret_cast<std::byte const*>(buffer.data()),
+                       buffer.size()}};
+    read(read_things, read_colors, value, last);
+    EXPECT_EQ(0, read.remaining());
+
+    ASSERT_EQ(2, read_things.size());
+    {
+        Thing const& t = read_things.at(10);
+        EXPECT_EQ("first", t.name);
+        EXPECT_EQ(ThingId{3}, t.id);
+        EXPECT_EQ(1.5, t.length.value());
+        EXPECT_EQ((std::vector<bool>{true, false, true}), t.flags);
+        ASSERT_TRUE(t.counts);
+        EXPECT_EQ((Array<int, 3>{1, 2, 3}), *t.counts);
+        ASSERT_TRUE(std::holds_alternative<std::string>(t.extra));
+        EXPECT_EQ("extra", std::get<std::string>(t.extra));
+        EXPECT_TRUE(t.spectra[Color::red].empty());
+        EXPECT_EQ((std::vector<double>{0.5, 1.5}), t.spectra[Color::green]);
+    }
+    {
+        Thing const& t = read_things.at(-2);
+        EXPECT_EQ("second", t.name);
+        EXPECT_FALSE(t.id);
+        EXPECT_FALSE(t.counts);
+        EXPECT_TRUE(std::holds_alternative<Empty>(t.extra));
+    }
+    EXPECT_EQ(colors, read_colors);
+    EXPECT_EQ(1.25, value);
+    EXPECT_EQ("done", last);
+
+    // Reading past the end of the data is an error
+    EXPECT_THROW(read(value), RuntimeError);
+}
+
+TEST_F(BinaryArchiveTest, file)
+{
+    std::string const filename = this->make_unique_filename(".bin");
+
+    std::string payload;
+    BinaryWriter write{&payload};
+    write(this->make_things());
+
+    BinaryFileKey key{"things", 12345};
+    write_binary_file(filename, key, payload);
+
+    {
+        MappedBinaryFile mapped{filename, key};
+        ASSERT_TRUE(mapped) << mapped.reason();
+        EXPECT_EQ(payload.size(), mapped.payload().size());
+
+        std::map<int, Thing> things;
+        BinaryReader read{mapped.payload()};
+        read(things);
+        EXPECT_EQ(0, read.remaining());
+        EXPECT_EQ(2, things.size());
+    }
+    {
+        MappedBinaryFile mapped{filename, BinaryFileKey{"things", 54321}};
+        EXPECT_FALSE(mapped);
+        EXPECT_EQ("input has changed", mapped.reason());
+        EXPECT_TRUE(mapped.payload().empty());
+    }
+    {
+        MappedBinaryFile mapped{filename, BinaryFileKey{"other", 12345}};
+        EXPECT_FALSE(mapped);
+        EXPECT_EQ("file contains 'things' data", mapped.reason());
+    }
+    {
+        MappedBinaryFile mapped{filename + ".missing", key};
+        EXPECT_FALSE(mapped);
+        EXPECT_EQ("file is missing or empty", mapped.reason());
+    }
+
+    // Corrupt the last byte of the payload
+    {
+        std::fstream f(filename,
+                       std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(-1, std::ios::end);
+        f.put(static_cast<char>(payload.back() + 1));
+    }
+    {
+        MappedBinaryFile mapped{filename, key};
+        EXPECT_FALSE(mapped);
+        EXPECT_EQ("checksum does not match", mapped.reason());
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -171,6 +171,24 @@ TEST_F(DeviceEventTest, TEST_IF_CELER_DEVICE(multi_stream))
     EXPECT_EQ(new_g_value, g_value);
 }
 
+TEST_F(DeviceEventTest, TEST_IF_CELER_DEVICE(timing))
+{
+    Stream s(device());
+    DeviceEvent start(device(), true);
+    DeviceEvent stop(device(), true);
+    ASSERT_TRUE(start && stop);
+
+    static int const delay_ms = 50;
+
+    // Time a delayed host function without synchronizing in between
+    start.record(s);
+    s.launch_host_func(my_host_kernel, const_cast<int*>(&delay_ms));
+    stop.record(s);
+
+    stop.sync();
+    EXPECT_GE(stop.elapsed_since(start), 0.9 * delay_ms * ms_to_s);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
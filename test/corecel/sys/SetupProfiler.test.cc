@@ -0,0 +1,130 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SetupProfiler.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/SetupProfiler.hh"
+
+#include <vector>
+
+#include "corecel/sys/SetupProfilerIO.json.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(SetupProfilerTest, nested)
+{
+    SetupProfiler profiler;
+    {
+        ScopedSetupPhase outer{"outer", &profiler};
+        {
+            ScopedSetupPhase first{"first", &profiler};
+            std::vector<char> temp(1 << 20, 'x');
+            EXPECT_EQ('x', temp.back());
+        }
+        ScopedSetupPhase second{"second", &profiler};
+    }
+    ScopedSetupPhase last{"last", &profiler};
+
+    auto phases = profiler.phases();
+    ASSERT_EQ(4, phases.size());
+    EXPECT_EQ(profiler.size(), phases.size());
+
+    std::vector<std::string> labels;
+    std::vector<int> parents;
+    for (auto const& p : phases)
+    {
+        labels.push_back(p.label);
+        parents.push_back(p.parent ? static_cast<int>(p.parent.get()) : -1);
+    }
+    static char const* const expected_labels[]
+        = {"outer", "first", "second", "last"};
+    EXPECT_VEC_EQ(expected_labels, labels);
+    static int const expected_parents[] = {-1, 0, 0, -1};
+    EXPECT_VEC_EQ(expected_parents, parents);
+
+    // Completed phases are timed; the parent encloses its children
+    EXPECT_GE(phases[0].time, phases[1].time + phases[2].time);
+    EXPECT_GE(phases[1].time, 0);
+    // Last phase is still in progress
+    EXPECT_EQ(0, phases[3].time);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(SetupProfilerTest, independent)
+{
+    SetupProfiler global_profiler;
+    SetupProfiler local_profiler;
+    {
+        ScopedSetupPhase global_outer{"global", &global_profiler};
+        ScopedSetupPhase global_inner{"global-inner", &global_profiler};
+        {
+            // Nesting is independent of the other profiler's phases
+            ScopedSetupPhase outer{"outer", &local_profiler};
+            ScopedSetupPhase inner{"inner", &local_profiler};
+        }
+        ScopedSetupPhase next{"next", &local_profiler};
+    }
+
+    auto get_parents = [](SetupProfiler const& profiler) {
+        std::vector<int> result;
+        for (auto const& p : profiler.phases())
+        {
+            result.push_back(p.parent ? static_cast<int>(p.parent.get())
+                                      : -1);
+        }
+        return result;
+    };
+    static int const expected_global_parents[] = {-1, 0};
+    EXPECT_VEC_EQ(expected_global_parents, get_parents(global_profiler));
+    static int const expected_local_parents[] = {-1, 0, -1};
+    EXPECT_VEC_EQ(expected_local_parents, get_parents(local_profiler));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(SetupProfilerTest, memory)
+{
+    MemoryUsage usage = get_memory_usage();
+    EXPECT_GE(usage.host_resident, 0);
+    EXPECT_GE(usage.host_peak, 0);
+    EXPECT_GE(usage.device_used, 0);
+#ifdef __linux__
+    EXPECT_GT(usage.host_resident, 0);
+    EXPECT_GE(usage.host_peak, usage.host_resident);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(SetupProfilerTest, output)
+{
+    SetupProfiler profiler;
+    {
+        ScopedSetupPhase outer{"outer", &profiler};
+        ScopedSetupPhase inner{"inner", &profiler};
+    }
+
+    nlohmann::json out = profiler;
+    ASSERT_TRUE(out.is_array());
+    ASSERT_EQ(2, out.size());
+    EXPECT_EQ("outer", out[0]["label"].get<std::string>());
+    EXPECT_TRUE(out[0]["parent"].is_null());
+    EXPECT_EQ("inner", out[1]["label"].get<std::string>());
+    EXPECT_EQ(0, out[1]["parent"].get<int>());
+    for (char const* key : {"time", "host_delta", "host_peak", "device_delta"})
+    {
+        EXPECT_TRUE(out[1].contains(key)) << key;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
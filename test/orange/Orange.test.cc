@@ -17,9 +17,12 @@
 #include "geocel/Types.hh"
 #include "geocel/UnitUtils.hh"
 #include "orange/Debug.hh"
+#include "orange/OrangeInput.hh"
 #include "orange/OrangeParams.hh"
 #include "orange/OrangeTrackView.hh"
 #include "orange/OrangeTypes.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/Sphere.hh"
 
 #include "OrangeGeoTestBase.hh"
 #include "TestMacros.hh"
@@ -148,8 +151,13 @@ TEST_F(OneVolumeTest, obz)
     EXPECT_VEC_SOFT_EQ(Real3({2, 2.5, 3}), data.reals[inner_range]);
     EXPECT_VEC_SOFT_EQ(Real3({3.1, 3.6, 4.1}), data.reals[outer_range]);
 
-    // Check translation id
-    EXPECT_EQ(10, obz_record.trans_id.get());
+    // Check transformation
+    ASSERT_TRUE(obz_record.trans_id);
+    auto const& trans = data.transforms[obz_record.trans_id];
+    EXPECT_EQ(TransformType::translation, trans.type);
+    ItemRange<celeritas::real_type> trans_range{
+        trans.data_offset, trans.data_offset + 3};
+    EXPECT_VEC_SOFT_EQ(Real3({1, 2, 3}), data.reals[trans_range]);
 }
 
 //---------------------------------------------------------------------------//
@@ -558,6 +566,209 @@ TEST_F(TwoVolumeTest, intersect_limited)
     EXPECT_FALSE(next.boundary);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Off-center cylinder whose safety relies on an oriented bounding zone.
+ */
+class ObzSafetyTest : public OrangeTest
+{
+    void SetUp() override
+    {
+        constexpr real_type hw = 1 / sqrt_two;
+
+        UnitInput input;
+        input.label = "obz safety";
+        input.bbox = {{0, -1, -10}, {2, 1, 10}};
+        input.surfaces = {CylZ({1, 0, 0}, 1.0)};
+        input.surface_labels = {Label("cyl")};
+
+        VolumeInput vi;
+        vi.faces = {LocalSurfaceId{0}};
+        vi.zorder = ZOrder::media;
+
+        // Outside: no bounding zone
+        vi.logic = {0};
+        vi.label = "outside";
+        vi.bbox = BBox::from_infinite();
+        input.volumes.push_back(vi);
+
+        // Inside: inscribed and enclosing boxes, truncated along z
+        vi.logic = {0, logic::lnot};
+        vi.label = "inside";
+        vi.bbox = input.bbox;
+        vi.obz.inner = {{1 - hw, -hw, -10}, {1 + hw, hw, 10}};
+        vi.obz.outer = input.bbox;
+        input.volumes.push_back(vi);
+
+        this->build_geometry(std::move(input));
+    }
+};
+
+TEST_F(ObzSafetyTest, safety)
+{
+    EXPECT_FALSE(this->params().supports_safety());
+
+    auto geo = this->make_geo_track_view();
+    real_type const hw = 1 / sqrt_two;
+
+    // Safety must never exceed the distance to the inner box (which is
+    // itself less than the distance to the cylinder), but the bounding zone
+    // is shrunk by only a small tolerance
+    auto check_safety = [&geo](real_type exact) {
+        real_type safety = geo.find_safety();
+        EXPECT_LE(safety, exact);
+        EXPECT_GT(safety, exact - real_type(1e-6));
+    };
+
+    // Center of the inner box
+    geo = Initializer_t{{1, 0, 0}, {1, 0, 0}};
+    EXPECT_EQ(ImplVolumeId{1}, geo.impl_volume_id());
+    check_safety(hw);
+
+    // Nearer a face of the inner box
+    geo = Initializer_t{{1, 0.5, 9.5}, {1, 0, 0}};
+    check_safety(hw - real_type(0.5));
+
+    // Nearer an inexact face of the inner box
+    geo = Initializer_t{{1.3, -0.7, 0}, {1, 0, 0}};
+    check_safety(hw - real_type(0.7));
+
+    // Between inner and outer boxes
+    geo = Initializer_t{{1.9, 0, 0}, {1, 0, 0}};
+    EXPECT_EQ(ImplVolumeId{1}, geo.impl_volume_id());
+    EXPECT_SOFT_EQ(0, geo.find_safety());
+
+    // Outside volume has no bounding zone
+    geo = Initializer_t{{3, 0, 0}, {1, 0, 0}};
+    EXPECT_EQ(ImplVolumeId{0}, geo.impl_volume_id());
+    EXPECT_SOFT_EQ(0, geo.find_safety());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Row of balls inside a large sphere, located with a voxel grid.
+ */
+class VoxelGridTest : public OrangeTest
+{
+  protected:
+    static constexpr real_type big_radius = 10;
+    static constexpr int num_balls = 5;
+
+    void SetUp() override
+    {
+        UnitInput unit;
+        unit.label = "balls";
+        unit.bbox = {{-big_radius, -big_radius, -big_radius},
+                     {big_radius, big_radius, big_radius}};
+        unit.surfaces.push_back(Sphere({0, 0, 0}, big_radius));
+        unit.surface_labels.push_back(Label("big"));
+
+        VolumeInput outside;
+        outside.faces = {LocalSurfaceId{0}};
+        outside.logic = {0};
+        outside.label = "outside";
+        outside.bbox = BBox::from_infinite();
+        outside.zorder = ZOrder::media;
+        unit.volumes.push_back(std::move(outside));
+
+        VolumeInput fill;
+        fill.faces = {LocalSurfaceId{0}};
+        fill.logic = {0, logic::lnot};
+        fill.label = "fill";
+        fill.bbox = unit.bbox;
+        fill.zorder = ZOrder::media;
+
+        for (auto i : range(num_balls))
+        {
+            Real3 center = this->ball_center(i);
+            LocalSurfaceId sid(unit.surfaces.size());
+            unit.surfaces.push_back(Sphere(center, 1));
+            unit.surface_labels.push_back(Label("s" + std::to_string(i)));
+
+            VolumeInput ball;
+            ball.faces = {sid};
+            ball.logic = {0, logic::lnot};
+            ball.label = "ball" + std::to_string(i);
+            ball.bbox = {center - Real3{1, 1, 1}, center + Real3{1, 1, 1}};
+            ball.zorder = ZOrder::media;
+            unit.volumes.push_back(std::move(ball));
+
+            fill.faces.push_back(sid);
+            fill.logic.insert(
+                fill.logic.end(),
+                {static_cast<logic_int>(fill.faces.size() - 1), logic::land});
+        }
+        unit.volumes.push_back(std::move(fill));
+
+        OrangeInput input;
+        input.universes.push_back(std::move(unit));
+        input.tol = Tolerance<>::from_default();
+        input.construction_opts.voxel_options.max_voxels = 1000;
+        input.construction_opts.voxel_options.min_volumes = 1;
+        this->build_geometry(std::move(input));
+    }
+
+    static Real3 ball_center(int i)
+    {
+        return {static_cast<real_type>(3 * (i - num_balls / 2)), 0, 0};
+    }
+
+    //! Exact safety distance and volume index
+    static std::pair<real_type, int> calc_exact(Real3 const& pos)
+    {
+        real_type fill_safety = big_radius - norm(pos);
+        for (auto i : range(num_balls))
+        {
+            real_type dist = distance(pos, ball_center(i));
+            if (dist < 1)
+            {
+                return {1 - dist, i + 1};
+            }
+            fill_safety = std::min(fill_safety, dist - 1);
+        }
+        return {fill_safety, num_balls + 1};
+    }
+};
+
+TEST_F(VoxelGridTest, grid)
+{
+    auto const& unit = this->host_params().simple_units[SimpleUnitId{0}];
+    ASSERT_TRUE(unit.voxel_grid);
+    EXPECT_EQ((Array<size_type, 3>{10, 10, 10}), unit.voxel_grid.dims);
+    EXPECT_LT(0, unit.voxel_grid.metadata.num_safe_cells);
+    EXPECT_LE(unit.voxel_grid.metadata.num_candidates, 1000 * 2);
+}
+
+TEST_F(VoxelGridTest, locate_and_safety)
+{
+    auto geo = this->make_geo_track_view();
+
+    int num_positive = 0;
+    for (real_type x : {-8.5, -6.2, -3.1, -1.7, 0.05, 0.9, 2.5, 6.01, 9.2})
+    {
+        for (real_type y : {-0.97, -0.3, 0.0, 0.45, 3.3, 7.7})
+        {
+            for (real_type z : {-0.5, 0.2, 2.1})
+            {
+                Real3 pos{x, y, z};
+                auto [exact, vol] = calc_exact(pos);
+                if (exact < 0 || std::fabs(exact) < 1e-6)
+                {
+                    // Outside or on a boundary
+                    continue;
+                }
+                geo = Initializer_t{pos, {1, 0, 0}};
+                EXPECT_EQ(ImplVolumeId(vol), geo.impl_volume_id())
+                    << "at " << repr(pos);
+                real_type safety = geo.find_safety();
+                EXPECT_LE(safety, exact * (1 + 1e-10)) << "at " << repr(pos);
+                num_positive += (safety > 0);
+            }
+        }
+    }
+    EXPECT_LT(0, num_positive);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -119,7 +119,7 @@ void OrangeGeoTestBase::build_geometry(OneVolInput inp)
         // Fake OBZ
         BBox inner{{1, 1, 1}, {3, 4, 5}};
         BBox outer{{2, 2, 2}, {4.2, 5.2, 6.2}};
-        vi.obz = {inner, outer, TransformId{10}};
+        vi.obz = {inner, outer, Translation{{1, 2, 3}}};
 
         return vi;
     }()};
@@ -173,7 +173,17 @@ void OrangeGeoTestBase::build_geometry(TwoVolInput inp)
 void OrangeGeoTestBase::build_geometry(UnitInput input)
 {
     CELER_EXPECT(input);
-    params_ = std::make_unique<Params>(to_input(std::move(input)), nullptr);
+    return this->build_geometry(to_input(std::move(input)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a geometry from a full input.
+ */
+void OrangeGeoTestBase::build_geometry(OrangeInput input)
+{
+    CELER_EXPECT(!params_);
+    params_ = std::make_unique<Params>(std::move(input), nullptr);
     // Base class will construct geometry from this call via build_geometry
     ASSERT_TRUE(this->geometry());
 }
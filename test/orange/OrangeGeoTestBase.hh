@@ -21,6 +21,7 @@
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
+struct OrangeInput;
 struct UnitInput;
 class OrangeParams;
 
@@ -76,6 +77,9 @@ class OrangeGeoTestBase : public OrangeTestBase
     // Load geometry from a single unit
     void build_geometry(UnitInput);
 
+    // Load geometry from a full input
+    void build_geometry(OrangeInput);
+
     //! Get the data after loading
     Params const& params() const
     {
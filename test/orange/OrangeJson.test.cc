@@ -7,18 +7,23 @@
 
 #include <string>
 #include <vector>
+#include <nlohmann/json.hpp>
 
 #include "corecel/StringSimplifier.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/data/StateDataStore.hh"
 #include "corecel/io/Label.hh"
 #include "corecel/io/OutputInterface.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "corecel/math/SoftEqual.hh"
 #include "geocel/Types.hh"
+#include "geocel/VolumeParams.hh"
 #include "orange/Debug.hh"
+#include "orange/OrangeData.hh"
 #include "orange/OrangeParams.hh"
 #include "orange/OrangeParamsOutput.hh"
 #include "orange/OrangeTrackView.hh"
+#include "orange/detail/OrangeParamsCache.hh"
 
 #include "OrangeGeoTestBase.hh"
 #include "TestMacros.hh"
@@ -64,6 +69,17 @@ class JsonOrangeTest : public OrangeGeoTestBase
         auto const& bbox = this->params().bbox();
         return distance(bbox.lower(), bbox.upper());
     }
+
+    //! Get params output without the (nondeterministic) timing
+    std::string params_output() const
+    {
+        auto j = nlohmann::json::parse(
+            to_string(OrangeParamsOutput{this->geometry()}));
+        auto const& timing = j.at("universe_timing");
+        EXPECT_EQ(timing.at("label").size(), timing.at("insert").size());
+        j.erase("universe_timing");
+        return j.dump();
+    }
 };
 
 class InputBuilderTest : public JsonOrangeTest
@@ -200,7 +216,41 @@ TEST_F(UniversesTest, TEST_IF_CELERITAS_DOUBLE(output))
 
     EXPECT_JSON_EQ(
         R"json({"_category":"internal","_label":"orange","bvh_metadata":{"depth":[4,3,1],"num_finite_bboxes":[4,4,1],"num_infinite_bboxes":[1,0,0]},"scalars":{"max_faces":14,"max_intersections":14,"num_univ_levels":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bvh":{"bboxes":12,"internal_nodes":5,"leaf_nodes":8,"local_volume_ids":10},"connectivity_records":25,"daughters":3,"local_surface_ids":55,"local_volume_ids":21,"logic_ints":164,"obz_records":0,"real_ids":25,"reals":24,"rect_arrays":0,"simple_units":3,"surface_types":25,"transforms":3,"univ_indices":3,"univ_types":3,"universe_indexer":{"surfaces":4,"volumes":4},"volume_ids":12,"volume_instance_ids":12,"volume_records":12},"tracking_logic":"infix"})json",
-        to_string(out));
+        this->params_output());
+}
+
+TEST_F(UniversesTest, cache)
+{
+    auto const& orig = this->geometry();
+    std::string filename = this->make_unique_filename(".org.bin");
+    detail::write_orange_cache(filename, 1234, *orig);
+
+    // Stale hash
+    EXPECT_FALSE(detail::read_orange_cache(filename, 4321));
+
+    auto cached = detail::read_orange_cache(filename, 1234);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(orig->volumes() ? orig->volumes()->num_volumes() : 0,
+              cached->num_volumes);
+    auto volumes = orig->volumes();
+    auto loaded
+        = std::make_shared<OrangeParams>(std::move(*cached), std::move(volumes));
+
+    EXPECT_EQ(orig->bbox(), loaded->bbox());
+    EXPECT_EQ(orig->supports_safety(), loaded->supports_safety());
+    EXPECT_EQ(orig->impl_volumes().size(), loaded->impl_volumes().size());
+    EXPECT_EQ(orig->surfaces().size(), loaded->surfaces().size());
+    EXPECT_EQ(orig->universes().size(), loaded->universes().size());
+    EXPECT_EQ(orig->find_volume_instance_at({-1, -1, 0.5}),
+              loaded->find_volume_instance_at({-1, -1, 0.5}));
+
+    // Output is identical except for construction timing
+    auto get_output = [](std::shared_ptr<OrangeParams const> const& params) {
+        auto j = nlohmann::json::parse(to_string(OrangeParamsOutput{params}));
+        j.erase("universe_timing");
+        return j.dump();
+    };
+    EXPECT_EQ(get_output(orig), get_output(loaded));
 }
 
 TEST_F(UniversesTest, initialize_with_multiple_universes)
@@ -555,6 +605,58 @@ TEST_F(UniversesTest, reentrant)
     EXPECT_GT(dot_product(geo.normal(), geo.dir()), 0);
 }
 
+TEST_F(UniversesTest, tiled_layout)
+{
+    using StateStore = StateDataStore<OrangeStateData, MemSpace::host>;
+
+    // Use a partial final tile
+    size_type const num_tracks = 11;
+    auto make_states = [&](size_type log2_tile) {
+        HostVal<OrangeStateData> states;
+        resize(&states, this->host_params(), num_tracks, log2_tile);
+        EXPECT_EQ(log2_tile, states.log2_tile);
+        return StateStore{std::move(states)};
+    };
+    StateStore contiguous = make_states(0);
+    StateStore tiled = make_states(2);
+    EXPECT_EQ(3 * 11, contiguous.ref().pos.size());
+    EXPECT_EQ(3 * 12, tiled.ref().pos.size());
+
+    // Initialize all tracks at various depths before moving any
+    std::vector<Real3> const points = {{-1, -2, 1},
+                                       {0.625, -2, 1},
+                                       {0.25, -3.7, 0.7},
+                                       {2, 1, 1},
+                                       {-1.5, 3, 0}};
+    for (auto* store : {&contiguous, &tiled})
+    {
+        for (auto i : range(num_tracks))
+        {
+            OrangeTrackView geo(
+                this->host_params(), store->ref(), TrackSlotId{i});
+            geo = Initializer_t{points[i % points.size()], {0, 1, 0}};
+        }
+        for (auto i : range(num_tracks))
+        {
+            OrangeTrackView geo(
+                this->host_params(), store->ref(), TrackSlotId{i});
+            geo.find_next_step(this->max_step());
+            geo.move_to_boundary();
+            geo.cross_boundary();
+        }
+    }
+
+    for (auto i : range(num_tracks))
+    {
+        OrangeTrackView expected(
+            this->host_params(), contiguous.ref(), TrackSlotId{i});
+        OrangeTrackView actual(
+            this->host_params(), tiled.ref(), TrackSlotId{i});
+        EXPECT_EQ(to_json_string(expected), to_json_string(actual))
+            << "track slot " << i;
+    }
+}
+
 //---------------------------------------------------------------------------//
 class RectArrayTest : public JsonOrangeTest
 {
@@ -714,7 +816,7 @@ TEST_F(HexArrayTest, TEST_IF_CELERITAS_DOUBLE(output))
 
     EXPECT_JSON_EQ(
         R"json({"_category":"internal","_label":"orange","bvh_metadata":{"depth":[1,8,1,1],"num_finite_bboxes":[2,50,1,1],"num_infinite_bboxes":[1,0,0,0]},"scalars":{"max_faces":9,"max_intersections":10,"num_univ_levels":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bvh":{"bboxes":58,"internal_nodes":49,"leaf_nodes":53,"local_volume_ids":55},"connectivity_records":53,"daughters":51,"local_surface_ids":191,"local_volume_ids":348,"logic_ints":500,"obz_records":0,"real_ids":53,"reals":272,"rect_arrays":0,"simple_units":4,"surface_types":53,"transforms":51,"univ_indices":4,"univ_types":4,"universe_indexer":{"surfaces":5,"volumes":5},"volume_ids":58,"volume_instance_ids":58,"volume_records":58},"tracking_logic":"infix"})json",
-        to_string(out));
+        this->params_output());
 }
 
 TEST_F(HexArrayTest, track_out)
@@ -775,10 +877,9 @@ TEST_F(InputBuilderTest, globalspheres)
         EXPECT_VEC_SOFT_EQ(expected_hw_safety, result.halfway_safeties);
     }
 
-    OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
         R"json({"_category":"internal","_label":"orange","bvh_metadata":{"depth":[1],"num_finite_bboxes":[2],"num_infinite_bboxes":[1]},"scalars":{"max_faces":2,"max_intersections":4,"num_univ_levels":1,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bvh":{"bboxes":3,"internal_nodes":0,"leaf_nodes":1,"local_volume_ids":3},"connectivity_records":2,"daughters":0,"local_surface_ids":4,"local_volume_ids":4,"logic_ints":7,"obz_records":0,"real_ids":2,"reals":2,"rect_arrays":0,"simple_units":1,"surface_types":2,"transforms":0,"univ_indices":1,"univ_types":1,"universe_indexer":{"surfaces":2,"volumes":2},"volume_ids":3,"volume_instance_ids":3,"volume_records":3},"tracking_logic":"infix"})json",
-        to_string(out));
+        this->params_output());
 }
 
 //---------------------------------------------------------------------------//
@@ -841,10 +942,9 @@ TEST_F(InputBuilderTest, bgspheres)
         EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
     }
 
-    OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
         R"json({"_category":"internal","_label":"orange","bvh_metadata":{"depth":[2],"num_finite_bboxes":[2],"num_infinite_bboxes":[1]},"scalars":{"max_faces":3,"max_intersections":2,"num_univ_levels":1,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bvh":{"bboxes":4,"internal_nodes":1,"leaf_nodes":2,"local_volume_ids":3},"connectivity_records":3,"daughters":0,"local_surface_ids":6,"local_volume_ids":3,"logic_ints":5,"obz_records":0,"real_ids":3,"reals":9,"rect_arrays":0,"simple_units":1,"surface_types":3,"transforms":0,"univ_indices":1,"univ_types":1,"universe_indexer":{"surfaces":2,"volumes":2},"volume_ids":4,"volume_instance_ids":4,"volume_records":4},"tracking_logic":"infix"})json",
-        to_string(out));
+        this->params_output());
 }
 
 //---------------------------------------------------------------------------//
@@ -965,19 +1065,17 @@ TEST_F(InputBuilderTest, hierarchy)
         EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
     }
 
-    OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
         R"json({"_category":"internal","_label":"orange","bvh_metadata":{"depth":[4,0,0,4,2,0,0],"num_finite_bboxes":[6,0,0,4,2,0,0],"num_infinite_bboxes":[1,0,0,0,0,0,0]},"scalars":{"max_faces":8,"max_intersections":14,"num_univ_levels":3,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bvh":{"bboxes":24,"internal_nodes":8,"leaf_nodes":15,"local_volume_ids":13},"connectivity_records":13,"daughters":6,"local_surface_ids":20,"local_volume_ids":18,"logic_ints":31,"obz_records":0,"real_ids":13,"reals":46,"rect_arrays":0,"simple_units":7,"surface_types":13,"transforms":6,"univ_indices":7,"univ_types":7,"universe_indexer":{"surfaces":8,"volumes":8},"volume_ids":24,"volume_instance_ids":24,"volume_records":24},"tracking_logic":"infix"})json",
-        to_string(out));
+        this->params_output());
 }
 
 //---------------------------------------------------------------------------//
 TEST_F(InputBuilderTest, incomplete_bb)
 {
-    OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
         R"json({"_category":"internal","_label":"orange","bvh_metadata":{"depth":[1,1],"num_finite_bboxes":[2,2],"num_infinite_bboxes":[1,0]},"scalars":{"max_faces":6,"max_intersections":6,"num_univ_levels":2,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bvh":{"bboxes":6,"internal_nodes":0,"leaf_nodes":2,"local_volume_ids":5},"connectivity_records":8,"daughters":1,"local_surface_ids":10,"local_volume_ids":4,"logic_ints":37,"obz_records":0,"real_ids":8,"reals":26,"rect_arrays":0,"simple_units":2,"surface_types":8,"transforms":1,"univ_indices":2,"univ_types":2,"universe_indexer":{"surfaces":3,"volumes":3},"volume_ids":6,"volume_instance_ids":6,"volume_records":6},"tracking_logic":"infix"})json",
-        to_string(out));
+        this->params_output());
 }
 
 //---------------------------------------------------------------------------//
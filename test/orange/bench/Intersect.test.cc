@@ -0,0 +1,121 @@
+//------------------------------- -*- C++ -*- -------------------------------//
+// Copyright Celeritas contributors: see top-level COPYRIGHT file for details
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/bench/Intersect.test.cc
+//---------------------------------------------------------------------------//
+#include <random>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/random/distribution/IsotropicDistribution.hh"
+#include "corecel/random/distribution/UniformBoxDistribution.hh"
+#include "orange/OrangeData.hh"
+#include "orange/OrangeGeoTestBase.hh"
+#include "orange/OrangeParams.hh"
+#include "orange/univ/SimpleUnitTracker.hh"
+
+#include "Benchmark.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Time intersection searches from random points in the global universe.
+ */
+class IntersectBench : public OrangeGeoTestBase
+{
+  protected:
+    using LocalState = ::celeritas::detail::LocalState;
+
+    BenchmarkResult run_bench(size_type num_states, size_type num_calls);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample points uniformly in the bounding box and time \c intersect.
+ *
+ * Points that fail to initialize or are in the exterior are discarded.
+ */
+BenchmarkResult
+IntersectBench::run_bench(size_type num_states, size_type num_calls)
+{
+    SimpleUnitTracker tracker(this->host_params(), SimpleUnitId{0});
+
+    LocalState temp;
+    auto const& hsref = this->host_state();
+    auto face_storage = hsref.temp_face[AllItems<FaceId>{}];
+    temp.temp_next.face = face_storage.data();
+    temp.temp_next.distance = hsref.temp_distance[AllItems<real_type>{}].data();
+    temp.temp_next.isect = hsref.temp_isect[AllItems<size_type>{}].data();
+    temp.temp_next.size = face_storage.size();
+
+    std::mt19937 rng;
+    auto const& bbox = this->params().bbox();
+    UniformBoxDistribution<> sample_box{bbox.lower(), bbox.upper()};
+    IsotropicDistribution<> sample_isotropic;
+
+    std::vector<LocalState> states;
+    while (states.size() < num_states)
+    {
+        LocalState state = temp;
+        state.pos = sample_box(rng);
+        state.dir = sample_isotropic(rng);
+        auto init = tracker.initialize(state);
+        if (!init.volume || init.volume == orange_exterior_volume)
+        {
+            continue;
+        }
+        state.volume = init.volume;
+        states.push_back(state);
+    }
+
+    size_type i = 0;
+    BenchmarkResult result;
+    result.metrics = {
+        {"num_states", num_states},
+        {"num_calls", num_calls},
+    };
+    result.metrics["ns_per_call"] = time_per_call(
+        [&] { return tracker.intersect(states[i++ % num_states]).distance; },
+        num_calls);
+    write_benchmark(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+class FiveVolumesBench : public IntersectBench
+{
+    void SetUp() override { this->build_geometry("five-volumes.org.json"); }
+};
+
+class TestEm3Bench : public IntersectBench
+{
+    void SetUp() override { this->build_geometry("testem3.org.json"); }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FiveVolumesBench, intersect)
+{
+    auto result = this->run_bench(4096, 1000000);
+    EXPECT_GT(result.metrics["ns_per_call"], 0);
+}
+
+TEST_F(TestEm3Bench, intersect)
+{
+    auto result = this->run_bench(4096, 1000000);
+    EXPECT_GT(result.metrics["ns_per_call"], 0);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -81,7 +81,7 @@ class BvhEnclosingVolFinderTest : public Test
  */
 TEST_F(BvhEnclosingVolFinderTest, basic)
 {
-    auto run_test = [&](size_type max_leaf_size) {
+    auto run_test = [&](size_type max_leaf_size, size_type width) {
         VecFastBbox bboxes = {
             FastBBox::from_infinite(),
             {{0, 0, 0}, {1.6f, 1, 100}},
@@ -91,8 +91,11 @@ TEST_F(BvhEnclosingVolFinderTest, basic)
             {{0, -1, 0}, {5, 0, 100}},
         };
 
-        BvhBuilder build(&storage_, BvhBuilder::Input{max_leaf_size});
+        BvhBuilder::Input inp{max_leaf_size};
+        inp.width = width;
+        BvhBuilder build(&storage_, inp);
         auto bvh_tree = build(VecFastBbox{bboxes}, implicit_vol_ids_);
+        EXPECT_EQ(width > 2, !bvh_tree.wide_nodes.empty());
 
         ref_storage_ = storage_;
         BvhEnclosingVolFinder find_volume(bvh_tree, ref_storage_);
@@ -124,7 +127,10 @@ TEST_F(BvhEnclosingVolFinderTest, basic)
 
     for (auto max_leaf_size : range(1, 4))
     {
-        run_test(max_leaf_size);
+        for (auto width : range(2, 5))
+        {
+            run_test(max_leaf_size, width);
+        }
     }
 }
 
@@ -147,7 +153,7 @@ TEST_F(BvhEnclosingVolFinderTest, basic)
  */
 TEST_F(BvhEnclosingVolFinderTest, grid)
 {
-    auto run_test = [&](size_type max_leaf_size) {
+    auto run_test = [&](size_type max_leaf_size, size_type width) {
         VecFastBbox bboxes = {FastBBox::from_infinite()};
         for (auto i : range(3))
         {
@@ -159,8 +165,11 @@ TEST_F(BvhEnclosingVolFinderTest, grid)
             }
         }
 
-        BvhBuilder build(&storage_, BvhBuilder::Input{max_leaf_size});
+        BvhBuilder::Input inp{max_leaf_size};
+        inp.width = width;
+        BvhBuilder build(&storage_, inp);
         auto bvh_tree = build(VecFastBbox{bboxes}, implicit_vol_ids_);
+        EXPECT_EQ(width > 2, !bvh_tree.wide_nodes.empty());
 
         ref_storage_ = storage_;
         BvhEnclosingVolFinder find_volume(bvh_tree, ref_storage_);
@@ -186,7 +195,10 @@ TEST_F(BvhEnclosingVolFinderTest, grid)
 
     for (auto max_leaf_size : range(1, 4))
     {
-        run_test(max_leaf_size);
+        for (auto width : range(2, 5))
+        {
+            run_test(max_leaf_size, width);
+        }
     }
 }
 
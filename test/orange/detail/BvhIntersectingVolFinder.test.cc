@@ -805,6 +805,79 @@ TEST_F(KebabTest, all)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Kebab geometry with wide BVH nodes.
+ */
+class WideKebabTest : public KebabTest
+{
+  public:
+    VecSetup make_bvh_setups() const override
+    {
+        VecSetup result;
+        for (auto width : {3, 4})
+        {
+            for (auto leaf_size : {1, 4, 16})
+            {
+                inp::BvhBuilder setup;
+                setup.max_leaf_size = leaf_size;
+                setup.width = width;
+                result.push_back(setup);
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(WideKebabTest, all)
+{
+    Real3 pos{0, 0, 0}, dir{0, 0, 1};
+    DistMap dist_map;
+    {
+        SCOPED_TRACE("Test everything, no hits");
+        auto result = this->get_result({pos, dir}, dist_map, large);
+
+        IntersectResult ref;
+        ref.distance = large;
+        ref.intersect_surface = {};
+        ref.hit_count = {0, 0, 0, 0, 0, 0};
+        ref.miss_count = {1024, 1024, 1024, 1024, 1024, 1024};
+        EXPECT_REF_EQ(ref, result) << result;
+    }
+    {
+        SCOPED_TRACE("Start halfway, hit quickly");
+        pos = {0, 0, 512};
+        dist_map = {
+            {LocalVolumeId{514}, 2.9},
+            {LocalVolumeId{1000}, 488.9},
+        };
+        auto result = this->get_result({pos, dir}, dist_map, large);
+        EXPECT_SOFT_EQ(2.9, result.distance);
+        EXPECT_EQ(LocalSurfaceId{514}, result.intersect_surface);
+        EXPECT_EQ(std::vector<int>(6, 1), result.hit_count);
+    }
+    {
+        SCOPED_TRACE("Start halfway, hit less quickly");
+        pos = {0, 0, 512};
+        dir = {0, 0, -1};
+        dist_map = {
+            {LocalVolumeId{510}, 2.1},
+            {LocalVolumeId{500}, 12.1},
+            {LocalVolumeId{400}, 112.1},
+            {LocalVolumeId{200}, 312.1},
+            {LocalVolumeId{0}, 512.1},
+        };
+        auto result = this->get_result({pos, dir}, dist_map, large);
+        EXPECT_SOFT_EQ(2.1, result.distance);
+        EXPECT_EQ(LocalSurfaceId{510}, result.intersect_surface);
+        for (auto misses : result.miss_count)
+        {
+            // Nearer children are visited first, so few volumes are tested
+            EXPECT_LE(misses, 32);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail
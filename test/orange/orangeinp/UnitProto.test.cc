@@ -492,6 +492,7 @@ class InputBuilderTest : public UnitProtoTest
         InputBuilder build_input(InputBuilder::Input{inp_});
         OrangeInput inp = build_input(global);
         EXPECT_TRUE(inp);
+        EXPECT_EQ(inp.universes.size(), inp.build_times.size());
         std::string const base_path = this->test_data_path("orange", "");
         std::string const ref_path = base_path + output_base + ".org.json";
 
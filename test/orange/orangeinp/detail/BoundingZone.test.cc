@@ -262,11 +262,11 @@ TEST_F(BoundingZoneTest, calc_intersection)
         EXPECT_FALSE(bz.negated);
     }
     {
-        // Degenerate test: edges are "in"
+        // Degenerate test: edges are "in" but no interior point is known
         auto box = make_bz({0.5, 0, 0}, 0.5, 0.5);
         auto negbox = negated_bz(box);
         auto bz = calc_intersection(box, negbox);
-        EXPECT_EQ(box.interior, bz.interior);
+        EXPECT_FALSE(bz.interior) << bz.interior;
         EXPECT_EQ(box.exterior, bz.exterior);
         EXPECT_FALSE(bz.negated);
     }
@@ -327,6 +327,33 @@ TEST_F(BoundingZoneTest, calc_union)
     }
 }
 
+TEST_F(BoundingZoneTest, degenerate_difference)
+{
+    // Box minus a sphere whose exterior is exactly the box
+    auto const box = make_bz({0, 0, 0}, 1.0, 1.0);
+    auto const sph = make_bz({0, 0, 0}, 1.0, 0.7);
+    {
+        // Only the corners remain: no point is known to be inside
+        auto bz = calc_intersection(box, negated_bz(sph));
+        EXPECT_FALSE(bz.negated);
+        EXPECT_FALSE(bz.interior) << bz.interior;
+        EXPECT_EQ(box.exterior, bz.exterior);
+    }
+    {
+        // Box minus itself
+        auto bz = calc_intersection(box, negated_bz(box));
+        EXPECT_FALSE(bz.negated);
+        EXPECT_FALSE(bz.interior) << bz.interior;
+    }
+    {
+        // Same by DeMorgan's law
+        auto bz = calc_union(negated_bz(box), sph);
+        EXPECT_TRUE(bz.negated);
+        EXPECT_FALSE(bz.interior) << bz.interior;
+        EXPECT_EQ(box.exterior, bz.exterior);
+    }
+}
+
 /*!
  * Test an intersection of unions.
  *